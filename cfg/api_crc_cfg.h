@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 // Includes
 //------------------------------------------------------------------------------
+#include "../inc/api_crc.h"
 
 //------------------------------------------------------------------------------
 // Preprocessor
@@ -33,10 +34,8 @@
 #define NULL 0
 
 //****************** Set options and details of include files ******************
-#define BUILD_FOR_PERFORM 0	//!< Macro for optimization of build CRC library for high performance
-#define BUILD_FOR_SIZE 1	//!< Macro for optimization of build CRC library for small size
-#define BUILD_FOR_DATA 2	//!< Macro for optimization of build CRC library for small data
-#define BUILD_FOR_DEBUG 3	//!< Macro for debug build of CRC library
+// The macros BUILD_FOR_PERFORM, BUILD_FOR_SIZE, BUILD_FOR_DATA and BUILD_FOR_DEBUG
+// are defined in inc/api_crc.h, the layout of api_crc_device_s depends on them.
 
 // Activate just one of the following 3 statements: BUILD_FOR_PERFORM, BUILD_FOR_SIZE, BUILD_FOR_DATA
 //#define OPTIMIZE BUILD_FOR_PERFORM
@@ -68,6 +67,10 @@
 
 // CPU 8-bit
 //#define PLATFORM_X86_8
+
+//! Threads of the POSIX API (pthreads) for api_crc_processParallel, without them
+//! the segments are processed one after another in the calling thread.
+#define API_CRC_PTHREADS
 //****************** end of list of user-definable parameters ******************
 
 //------------------------------------------------------------------------------
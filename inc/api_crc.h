@@ -33,14 +33,51 @@
 #include <stdint.h>
 #endif
 
+//! I/O vectors of the POSIX API (struct iovec) for ::api_crc_processv, without them,
+//! e.g. for 8-bit, 16-bit or non-POSIX targets, the function is not part of the library.
+#define API_CRC_IOVEC
+
+#ifdef API_CRC_IOVEC
+#include <sys/uio.h>
+#endif // API_CRC_IOVEC
+
 //------------------------------------------------------------------------------
 // Preprocessor
 //------------------------------------------------------------------------------
 
+#define BUILD_FOR_PERFORM 0	//!< Macro for optimization of build CRC library for high performance
+#define BUILD_FOR_SIZE 1	//!< Macro for optimization of build CRC library for small size
+#define BUILD_FOR_DATA 2	//!< Macro for optimization of build CRC library for small data
+#define BUILD_FOR_DEBUG 3	//!< Macro for debug build of CRC library
+
+//! Number of the constants ::api_crc_device_s.fold in the build of the library: all
+//! constants of the folding in the build for performance, the two constants of the
+//! Barrett reduction in the build for code size and none in the other builds. An
+//! application is compiled with the same macro OPTIMIZE as the library.
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+#define API_CRC_FOLD_SIZE 16U
+#elif (OPTIMIZE == BUILD_FOR_SIZE)
+#define API_CRC_FOLD_SIZE 2U
+#else
+#define API_CRC_FOLD_SIZE 0U
+#endif // OPTIMIZE
+
 //! \brief
 //! Macro for static initialization of a Cyclic Reduncancy Code (CRC) device as
 //! lvalue but without any sanity checks.
-#define API_CRC_INIT(POLYNOMIAL, INPUTXOR, OUTPUTXOR, TABLE, INPUTORDER, OUTPUTORDER) (api_crc_device_s){(uint64_t)POLYNOMIAL, (uint64_t)INPUTXOR, (uint64_t)OUTPUTXOR, (uint64_t *)TABLE, (api_crc_order_e)INPUTORDER, (api_crc_order_e)OUTPUTORDER}
+//!
+//! \note
+//! The table of the device is a byte-wise table (::API_CRC_TABLE_BYTE) and the
+//! constants of the carry-less multiplication are zero, so a device of the macro
+//! is processed by the lookup table only. The instructions of the CPU are used for
+//! a device of ::api_crc_init.
+#if (API_CRC_FOLD_SIZE > 0U)
+#define API_CRC_INIT(POLYNOMIAL, INPUTXOR, OUTPUTXOR, TABLE, INPUTORDER, OUTPUTORDER) (api_crc_device_s){(uint64_t)POLYNOMIAL, (uint64_t)INPUTXOR, (uint64_t)OUTPUTXOR, (uint64_t *)TABLE, (api_crc_order_e)INPUTORDER, (api_crc_order_e)OUTPUTORDER, API_CRC_TABLE_BYTE, {0U}}
+#else
+#define API_CRC_INIT(POLYNOMIAL, INPUTXOR, OUTPUTXOR, TABLE, INPUTORDER, OUTPUTORDER) (api_crc_device_s){(uint64_t)POLYNOMIAL, (uint64_t)INPUTXOR, (uint64_t)OUTPUTXOR, (uint64_t *)TABLE, (api_crc_order_e)INPUTORDER, (api_crc_order_e)OUTPUTORDER, API_CRC_TABLE_BYTE}
+#endif // API_CRC_FOLD_SIZE
+
+#define API_CRC_PARALLEL_THREADS 64U	//!< Maximum number of the threads of ::api_crc_processParallel.
 
 
 //------------------------------------------------------------------------------
@@ -69,6 +106,63 @@ typedef enum
     API_CRC_STATUS_NOT_SUPPORTED = 3,		//!< Function call is not supported.
 } api_crc_status_e;
 
+//! \enum api_crc_table_e
+//!
+//! \brief
+//! Layout of the lookup table used for processing the input bytes.
+typedef enum
+{
+    API_CRC_TABLE_BYTE = 0,				//!< One table of 256 entries, one input byte per lookup.
+    API_CRC_TABLE_SLICING_BY_8 = 1,		//!< Eight tables of 256 entries, eight input bytes per iteration.
+    API_CRC_TABLE_SLICING_BY_16 = 2,	//!< Sixteen tables of 256 entries, sixteen input bytes per iteration.
+    API_CRC_TABLE_NIBBLE = 3,			//!< One table of 16 entries, one half of an input byte per lookup.
+    API_CRC_TABLE_WORD = 4,			//!< One table of 65536 entries, two input bytes per lookup.
+} api_crc_table_e;
+
+//! \enum api_crc_fold_e
+//!
+//! \brief
+//! Index of the constants for the carry-less multiplication in ::api_crc_device_s.fold.
+//! The constants of the Barrett reduction come first, the build for code size keeps
+//! only them (see ::API_CRC_FOLD_SIZE).
+//! The constant of a distance d folds the low (high) 64 bits of a 128-bit block
+//! over d bits, i.e. it holds \f$x^{d} \bmod P\f$ (\f$x^{d+64} \bmod P\f$) in the order
+//! of the processed bits, for reflected devices \f$x^{d+63} \bmod P\f$ (\f$x^{d-1} \bmod P\f$).
+typedef enum
+{
+    API_CRC_FOLD_MU = 0,			//!< Barrett reduction, quotient \f$x^{128} / P\f$.
+    API_CRC_FOLD_POLYNOMIAL = 1,	//!< Barrett reduction, generator polynomial.
+    API_CRC_FOLD_128_LOW = 2,		//!< Folding over 128 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_128_HIGH = 3,		//!< Folding over 128 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_256_LOW = 4,		//!< Folding over 256 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_256_HIGH = 5,		//!< Folding over 256 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_384_LOW = 6,		//!< Folding over 384 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_384_HIGH = 7,		//!< Folding over 384 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_512_LOW = 8,		//!< Folding over 512 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_512_HIGH = 9,		//!< Folding over 512 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_1024_LOW = 10,		//!< Folding over 1024 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_1024_HIGH = 11,	//!< Folding over 1024 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_1536_LOW = 12,		//!< Folding over 1536 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_1536_HIGH = 13,	//!< Folding over 1536 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_2048_LOW = 14,		//!< Folding over 2048 bits, multiplier of the low 64 bits.
+    API_CRC_FOLD_2048_HIGH = 15,	//!< Folding over 2048 bits, multiplier of the high 64 bits.
+    API_CRC_FOLD_CONSTANTS = 16,	//!< Number of the constants.
+} api_crc_fold_e;
+
+//! \enum api_crc_engine_e
+//!
+//! \brief
+//! Engine of the CPU used by ::api_crc_process for the byte-wise table, see ::api_crc_setEngine.
+//! A selected engine permits the engines listed before it.
+typedef enum
+{
+    API_CRC_ENGINE_AUTO = 0,		//!< Best engine supported by the CPU, queried on first use.
+    API_CRC_ENGINE_TABLE = 1,		//!< Lookup table of the device, bit by bit without a table.
+    API_CRC_ENGINE_CLMUL = 2,		//!< Folding with the carry-less multiplication (PCLMULQDQ).
+    API_CRC_ENGINE_VPCLMUL = 3,		//!< Folding with VPCLMULQDQ (AVX-512) for buffers of at least 4096 bytes.
+    API_CRC_ENGINE_CRC32C = 4,		//!< Instruction CRC32 (SSE4.2) for the devices of CRC-32C (Castagnoli, LSB).
+} api_crc_engine_e;
+
 //------------------------------------------------------------------------------
 // Types
 //------------------------------------------------------------------------------
@@ -85,6 +179,10 @@ typedef struct
     uint64_t const *table;		//!< Lookup table for processing one input byte per iteration.
     api_crc_order_e inputOrder;	//!< Bit order for processing input bytes.
     api_crc_order_e outputOrder;//!< Bit order for storing the CRC checksum.
+    api_crc_table_e tableType;	//!< Layout of the lookup table.
+#if (API_CRC_FOLD_SIZE > 0U)
+    uint64_t fold[API_CRC_FOLD_SIZE];	//!< Constants for the carry-less multiplication, derived from the polynomial by ::api_crc_init.
+#endif // API_CRC_FOLD_SIZE
 } api_crc_device_s;
 
 //! \var api_crc_state_t
@@ -106,10 +204,32 @@ extern "C"
 api_crc_status_e api_crc_init(uint64_t const, uint64_t const, uint64_t const, uint64_t const *const, api_crc_order_e const, api_crc_order_e const, api_crc_device_s *const);
 api_crc_status_e api_crc_table(api_crc_device_s *const, uint64_t *const, uint16_t const);
 uint16_t api_crc_sizeofTable(uint64_t const);
+api_crc_status_e api_crc_tableOfType(api_crc_device_s *const, uint64_t *const, uint32_t const, api_crc_table_e const);
+uint32_t api_crc_sizeofTableOfType(uint64_t const, api_crc_table_e const);
+api_crc_status_e api_crc_rollTable(api_crc_device_s const *const, uint64_t *const, uint16_t const, uint32_t const);
 
 api_crc_status_e api_crc_reset(api_crc_device_s const *const, api_crc_state_t *const);
 api_crc_status_e api_crc_process(api_crc_device_s const *const, api_crc_state_t *const, uint8_t const *const, uint8_t const, uint32_t const);
+api_crc_status_e api_crc_processZeros(api_crc_device_s const *const, api_crc_state_t *const, uint64_t const);
+api_crc_status_e api_crc_processConstant(api_crc_device_s const *const, api_crc_state_t *const, uint8_t const, uint64_t const);
+api_crc_status_e api_crc_processMulti(api_crc_device_s const *const *const, api_crc_state_t *const, uint8_t const, uint8_t const *const, uint8_t const, uint32_t const);
+api_crc_status_e api_crc_processParallel(api_crc_device_s const *const, api_crc_state_t *const, uint8_t const *const, uint8_t const, uint32_t const, uint8_t const, uint32_t const);
+api_crc_status_e api_crc_processBatch(api_crc_device_s const *const, uint8_t const *const *const, uint32_t const *const, api_crc_state_t *const, uint32_t const);
+api_crc_status_e api_crc_processBatchBits(api_crc_device_s const *const, uint8_t const *const *const, uint32_t const *const, api_crc_state_t *const, uint32_t const);
+#ifdef API_CRC_IOVEC
+api_crc_status_e api_crc_processv(api_crc_device_s const *const, api_crc_state_t *const, struct iovec const *const, uint32_t const);
+#endif // API_CRC_IOVEC
+api_crc_status_e api_crc_processStrided(api_crc_device_s const *const, api_crc_state_t *const, uint8_t const *const, uint32_t const, uint32_t const, uint32_t const);
+api_crc_status_e api_crc_roll(api_crc_device_s const *const, uint64_t const *const, api_crc_state_t *const, uint8_t const, uint8_t const);
 api_crc_status_e api_crc_finalize(api_crc_device_s const *const, api_crc_state_t *const);
+api_crc_status_e api_crc_combine(api_crc_device_s const *const, api_crc_state_t *const, api_crc_state_t const, uint64_t const);
+api_crc_status_e api_crc_removePrefix(api_crc_device_s const *const, api_crc_state_t *const, api_crc_state_t const, uint64_t const);
+api_crc_status_e api_crc_removeSuffix(api_crc_device_s const *const, api_crc_state_t *const, api_crc_state_t const, uint64_t const);
+api_crc_status_e api_crc_derive(api_crc_device_s const *const, api_crc_state_t *const, uint64_t const);
+api_crc_status_e api_crc_patch(api_crc_device_s const *const, api_crc_state_t *const, uint64_t const, uint8_t const *const, uint8_t const *const, uint32_t const, uint64_t const);
+
+api_crc_engine_e api_crc_getEngine(void);
+api_crc_status_e api_crc_setEngine(api_crc_engine_e const);
 
 #ifdef __cplusplus
 }
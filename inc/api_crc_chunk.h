@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+#ifndef __API_CRC_CHUNK_H__
+#define __API_CRC_CHUNK_H__
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "api_crc.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+#define API_CRC_CHUNK_LANE_SIZE 256U	//!< Number of bytes of one of the four lanes scanned interleaved for a chunk boundary.
+
+//------------------------------------------------------------------------------
+// Types
+//------------------------------------------------------------------------------
+
+//! \struct api_crc_chunker_s
+//!
+//! \brief
+//! Chunker structure for splitting a buffer at content-defined boundaries, which
+//! are found by the CRC of a rolling window of bytes.
+typedef struct
+{
+    api_crc_device_s const *device;	//!< Device of the CRC for the rolling window and the checksums of the chunks.
+    uint64_t in[256U];				//!< State register after one input byte of the value of the index.
+    uint64_t out[256U];				//!< Contribution of an input byte of the value of the index to the state register after the window.
+    uint64_t maskSmall;				//!< Bits of the state register which must be zero for a boundary before the average size.
+    uint64_t maskLarge;				//!< Bits of the state register which must be zero for a boundary from the average size on.
+    uint32_t window;				//!< Size of the rolling window in bytes.
+    uint32_t minimum;				//!< Minimum size of a chunk in bytes.
+    uint32_t average;				//!< Average size of a chunk in bytes.
+    uint32_t maximum;				//!< Maximum size of a chunk in bytes.
+} api_crc_chunker_s;
+
+//------------------------------------------------------------------------------
+// Function Prototypes
+//------------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+api_crc_status_e api_crc_chunkerInit(api_crc_device_s const *const, uint32_t const, uint32_t const, uint32_t const, uint32_t const, api_crc_chunker_s *const);
+api_crc_status_e api_crc_chunk(api_crc_chunker_s const *const, uint8_t const *const, uint32_t const, uint32_t *const, api_crc_state_t *const);
+
+#ifdef __cplusplus
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Inline Functions
+//------------------------------------------------------------------------------
+
+#endif // __API_CRC_CHUNK_H__
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
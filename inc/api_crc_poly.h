@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+#ifndef __API_CRC_POLY_H__
+#define __API_CRC_POLY_H__
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "api_crc.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+#define API_CRC_POLY_FACTORS 64U	//!< Maximum number of the irreducible factors of a generator polynomial of the order 64, counted with multiplicity.
+
+//------------------------------------------------------------------------------
+// Function Prototypes
+//------------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+api_crc_status_e api_crc_polyMultiply(uint64_t const, uint64_t const, uint64_t *const);
+api_crc_status_e api_crc_polyGcd(uint64_t const, uint64_t const, uint64_t *const);
+api_crc_status_e api_crc_polyMod(uint64_t const, uint64_t const, uint64_t *const);
+api_crc_status_e api_crc_polyMultiplyMod(uint64_t const, uint64_t const, uint64_t const, uint64_t *const);
+api_crc_status_e api_crc_polyPowerMod(uint64_t const, uint64_t const, uint64_t const, uint64_t *const);
+api_crc_status_e api_crc_polyFactor(uint64_t const, uint64_t *const, uint8_t *const);
+api_crc_status_e api_crc_polyPeriod(uint64_t const, uint64_t *const);
+api_crc_status_e api_crc_polyIsIrreducible(uint64_t const, uint8_t *const);
+api_crc_status_e api_crc_polyIsPrimitive(uint64_t const, uint8_t *const);
+
+#ifdef __cplusplus
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Inline Functions
+//------------------------------------------------------------------------------
+
+#endif // __API_CRC_POLY_H__
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
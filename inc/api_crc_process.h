@@ -35,6 +35,18 @@
 // Preprocessor
 //------------------------------------------------------------------------------
 
+#if defined( PLATFORM_X86_64 ) && defined( __x86_64__ )
+#define API_CRC_CLMUL				//!< Folding with the carry-less multiplication (PCLMULQDQ) is available.
+#endif
+
+#define API_CRC_LANE_SIZE 1024U	//!< Number of bytes of one of the three lanes of the byte-wise table, the shift over a lane is derived from the folding over 2048 bits.
+
+#define API_CRC_CLMUL_MIN_SIZE 64U	//!< Minimum number of bytes for the folding, four 128-bit blocks.
+
+#define API_CRC_VPCLMUL_MIN_SIZE 4096U	//!< Minimum number of bytes for the folding with VPCLMULQDQ (AVX-512), which lowers the clock of the CPU.
+
+#define API_CRC_CRC32C_POLYNOMIAL 0x82F63B78U	//!< CRC-32C (Castagnoli) as reflected polynomial of a device.
+
 //------------------------------------------------------------------------------
 // Types
 //------------------------------------------------------------------------------
@@ -45,8 +57,51 @@
 
 void api_crc_processForwardBit(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint8_t const offset, uint32_t const size);
 void api_crc_processReverseBit(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint8_t const offset, uint32_t const size);
-void api_crc_processForwardLUT(api_crc_device_s const *const device, api_crc_register_t *const reg, api_crc_register_t (*const)(uint64_t const *const, uint8_t const), uint8_t const *const buffer, uint32_t const size);
-void api_crc_processReverseLUT(api_crc_device_s const *const device, api_crc_register_t *const reg, api_crc_register_t (*const)(uint64_t const *const, uint8_t const), uint8_t const *const buffer, uint32_t const size);
+void api_crc_processForwardLUT08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processForwardLUT16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processForwardLUT32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#ifdef PLATFORM_X86_64
+void api_crc_processForwardLUT64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#endif
+void api_crc_processReverseLUT08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processReverseLUT16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processReverseLUT32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#ifdef PLATFORM_X86_64
+void api_crc_processReverseLUT64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#endif
+
+void api_crc_processForwardNibble(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processReverseNibble(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processForwardWord(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processReverseWord(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+
+void api_crc_processForwardSlicing08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processForwardSlicing16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processForwardSlicing32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#ifdef PLATFORM_X86_64
+void api_crc_processForwardSlicing64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#endif
+void api_crc_processReverseSlicing08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processReverseSlicing16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+void api_crc_processReverseSlicing32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#ifdef PLATFORM_X86_64
+void api_crc_processReverseSlicing64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#endif
+
+#ifdef API_CRC_CLMUL
+uint8_t api_crc_supportedEngines(void);
+uint32_t api_crc_processForwardCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+uint32_t api_crc_processReverseCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#ifdef API_CRC_IOVEC
+uint8_t api_crc_processForwardCLMULv(api_crc_device_s const *const device, api_crc_register_t *const reg, struct iovec const *const vector, uint32_t const count, uint8_t *const rest);
+uint8_t api_crc_processReverseCLMULv(api_crc_device_s const *const device, api_crc_register_t *const reg, struct iovec const *const vector, uint32_t const count, uint8_t *const rest);
+#endif // API_CRC_IOVEC
+uint8_t api_crc_processForwardCLMULStrided(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint64_t const size, uint64_t const pitch, uint32_t const rows, uint8_t *const rest);
+uint8_t api_crc_processReverseCLMULStrided(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint64_t const size, uint64_t const pitch, uint32_t const rows, uint8_t *const rest);
+uint32_t api_crc_processForwardVPCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+uint32_t api_crc_processReverseVPCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+uint32_t api_crc_processCRC32C(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size);
+#endif
 
 #endif // API_CRC_PROCESS_H
 
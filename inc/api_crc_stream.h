@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+#ifndef __API_CRC_STREAM_H__
+#define __API_CRC_STREAM_H__
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "api_crc.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+#define API_CRC_STREAM_BLOCK_SIZE 1024U	//!< Number of bytes of the block, in which the bits of an unaligned chunk are realigned to whole bytes.
+#define API_CRC_STREAM_SHORT_SIZE 64U	//!< Number of whole bytes of a chunk, below which they are processed by the table of the cursor instead of ::api_crc_process.
+
+//------------------------------------------------------------------------------
+// Types
+//------------------------------------------------------------------------------
+
+//! \struct api_crc_cursor_s
+//!
+//! \brief
+//! Cursor structure for the CRC of a bit stream, which is delivered in chunks
+//! starting and ending at any bit.
+typedef struct
+{
+    api_crc_device_s const *device;	//!< Device of the CRC of the stream.
+    uint64_t table[256U];			//!< State register after one input byte of the value of the index, for the short chunks.
+    api_crc_state_t state;			//!< State register after all whole bytes of the stream.
+    uint8_t pending;				//!< Bits of the stream after the last whole byte, in the positions of the input order.
+    uint8_t count;					//!< Number of the pending bits, 0 to 7.
+} api_crc_cursor_s;
+
+//------------------------------------------------------------------------------
+// Function Prototypes
+//------------------------------------------------------------------------------
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+api_crc_status_e api_crc_cursorInit(api_crc_device_s const *const, api_crc_cursor_s *const);
+api_crc_status_e api_crc_cursorProcess(api_crc_cursor_s *const, uint8_t const *const, uint8_t const, uint32_t const);
+api_crc_status_e api_crc_cursorFinalize(api_crc_cursor_s const *const, api_crc_state_t *const);
+
+#ifdef __cplusplus
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Inline Functions
+//------------------------------------------------------------------------------
+
+#endif // __API_CRC_STREAM_H__
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
@@ -140,53 +140,59 @@ if [[ -e libCRC_generic_static.a ]]
 	rm libCRC_generic_static.a
 fi
 gcc   -c $CFLAGS ../src/api_crc.c
+gcc   -c $CFLAGS ../src/api_crc_poly.c
+gcc   -c $CFLAGS ../src/api_crc_chunk.c
+gcc   -c $CFLAGS ../src/api_crc_stream.c
 
 case $CFLAGS in
 	*BUILD_FOR_PERFORM*)
      echo BUILD_FOR_PERFORM
 	 gcc   -c $PFLAGS ../src/api_crc_process.c
-	 ar    rcs libCRC_generic_static.a api_crc.o api_crc_process.o
+	 ar    rcs libCRC_generic_static.a api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o api_crc_process.o
 	 ;;
     *BUILD_FOR_SIZE*)
      echo BUILD_FOR_SIZE
-	 ar    rcs libCRC_generic_static.a api_crc.o
+	 ar    rcs libCRC_generic_static.a api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o
 	 ;;
     *BUILD_FOR_DATA*)
      echo BUILD_FOR_DATA
-	 ar    rcs libCRC_generic_static.a api_crc.o
+	 ar    rcs libCRC_generic_static.a api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o
      ;;
     *BUILD_FOR_DEBUG*)
      echo BUILD_FOR_DEBUG
-	 ar    rcs libCRC_generic_static.a api_crc.o
+	 ar    rcs libCRC_generic_static.a api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o
      ;;
 esac
-LINK_LIB_STAT="-L../lib -lCRC_generic_static"
+LINK_LIB_STAT="-L../lib -lCRC_generic_static -lpthread"
 
 #build dynamic CRC lib
 echo  "Compile and build CRC-Generic dynamic library"
 echo  "build libCRC_generic_dynamic.so .."
 echo  ""
 gcc   -c $CFLAGS -fPIC ../src/api_crc.c
+gcc   -c $CFLAGS -fPIC ../src/api_crc_poly.c
+gcc   -c $CFLAGS -fPIC ../src/api_crc_chunk.c
+gcc   -c $CFLAGS -fPIC ../src/api_crc_stream.c
 
 case $CFLAGS in
 	*BUILD_FOR_PERFORM*)
 	 gcc   -c $PFLAGS -fPIC ../src/api_crc_process.c
-	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.1 -o libCRC_generic_dynamic.so.1.0.1 api_crc.o api_crc_process.o
+	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.2 -o libCRC_generic_dynamic.so.2.0.0 api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o api_crc_process.o -lpthread
 	 ;;
     *BUILD_FOR_SIZE*)
-	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.1 -o libCRC_generic_dynamic.so.1.0.1 api_crc.o
+	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.2 -o libCRC_generic_dynamic.so.2.0.0 api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o -lpthread
 	 ;;
     *BUILD_FOR_DATA*)
-	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.1 -o libCRC_generic_dynamic.so.1.0.1 api_crc.o
+	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.2 -o libCRC_generic_dynamic.so.2.0.0 api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o -lpthread
      ;;
     *BUILD_FOR_DEBUG*)
-	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.1 -o libCRC_generic_dynamic.so.1.0.1 api_crc.o
+	 gcc   -shared -Wl,-soname,libCRC_generic_dynamic.so.2 -o libCRC_generic_dynamic.so.2.0.0 api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o -lpthread
      ;;
 esac
-ln    -s -f libCRC_generic_dynamic.so.1.0.1 libCRC_generic_dynamic.so.1
-ln    -s -f libCRC_generic_dynamic.so.1.0.1 libCRC_generic_dynamic.so
-rm    -f api_crc.o api_crc_process.o
-LINK_LIB_DIN="-L../lib -lCRC_generic_dynamic -Wl,-rpath,../lib"
+ln    -s -f libCRC_generic_dynamic.so.2.0.0 libCRC_generic_dynamic.so.2
+ln    -s -f libCRC_generic_dynamic.so.2.0.0 libCRC_generic_dynamic.so
+rm    -f api_crc.o api_crc_poly.o api_crc_chunk.o api_crc_stream.o api_crc_process.o
+LINK_LIB_DIN="-L../lib -lCRC_generic_dynamic -lpthread -Wl,-rpath,../lib"
 
 #build tests
 echo  "Compile and build the Tests"
@@ -80,13 +80,31 @@
 //! The Interface of the CRC Generic library
 //!
 //! \details
-//! The Interface of the CRC Generic library consists of the 6 public functions:
+//! The Interface of the CRC Generic library consists of the 25 public functions:
 //! - The initialization function: \ref api_crc_init
 //! - The LUT table function: \ref api_crc_table
 //! - The function gives size of the table back: \ref api_crc_sizeofTable
+//! - The LUT table function for a given layout of the table: \ref api_crc_tableOfType
+//! - The function gives size of the table of a given layout back: \ref api_crc_sizeofTableOfType
+//! - The table function of the bytes leaving a window of the rolling CRC: \ref api_crc_rollTable
 //! - The method for cleaning of old data: \ref api_crc_reset
 //! - The method for calculate the CRC proof sum: \ref api_crc_process
+//! - The method advances the CRC proof sum over zero bits: \ref api_crc_processZeros
+//! - The method advances the CRC proof sum over copies of one byte: \ref api_crc_processConstant
+//! - The method calculates the CRC proof sums of several devices in one pass: \ref api_crc_processMulti
+//! - The method calculates the CRC proof sum in parallel threads: \ref api_crc_processParallel
+//! - The method calculates the CRC values of many short messages in one call: \ref api_crc_processBatch
+//! - The method calculates the CRC values of many messages of a few bits in one call: \ref api_crc_processBatchBits
+//! - The method calculates the CRC proof sum over the segments of an I/O vector: \ref api_crc_processv
+//! - The method moves the window of the rolling CRC by one byte: \ref api_crc_roll
 //! - The method for return the requested CRC value: \ref api_crc_finalize
+//! - The function combines the CRC values of two adjacent segments: \ref api_crc_combine
+//! - The function removes the leading segment from a CRC value: \ref api_crc_removePrefix
+//! - The function removes the trailing segment from a CRC value: \ref api_crc_removeSuffix
+//! - The function derives the CRC value of a device from the raw remainder: \ref api_crc_derive
+//! - The function updates the CRC value after a patch of the buffer: \ref api_crc_patch
+//! - The function gives the engine of the CPU back: \ref api_crc_getEngine
+//! - The function selects the engine of the CPU: \ref api_crc_setEngine
 //! \.
 //! a data structure: \ref api_crc_device_s \n
 //!
@@ -103,17 +121,32 @@
 
 #include "../inc/api_crc.h"
 #include "../cfg/api_crc_cfg.h"
+#include "api_crc_private.h"
 
 #if (OPTIMIZE == BUILD_FOR_PERFORM)
 #include "../inc/api_crc_process.h"
 #endif // OPTIMIZE
 
+#ifdef API_CRC_PTHREADS
+#include <pthread.h>
+#endif // API_CRC_PTHREADS
+
 //#include <stdio.h>
 
 //------------------------------------------------------------------------------
 // Preprocessor
 //------------------------------------------------------------------------------
 
+#define API_CRC_MULTI_BLOCK_SIZE 8192U	// Bytes of a block of api_crc_processMulti, processed by all devices while in the L1 cache.
+#define API_CRC_BATCH_LANES 8U			// Messages of api_crc_processBatch processed interleaved, one in each lane.
+#define API_CRC_BATCH_LONG_SIZE 256U	// Bytes of a message of api_crc_processBatch, from which on it is processed alone by api_crc_process.
+#define API_CRC_BATCH_SLICING_SIZE 32U	// Bytes of a message of api_crc_processBatch, from which on a slicing table is faster alone than the lanes.
+#define API_CRC_SLICED_LANES 64U		// Messages of api_crc_processBatchBits processed at once, one in each bit of a word.
+#define API_CRC_SLICED_MAX_SIZE 128U	// Bits of a message of api_crc_processBatchBits, above which it is processed alone by api_crc_process.
+#define API_CRC_SLICED_MIN_LANES 16U	// Messages of the last group of api_crc_processBatchBits, below which they are processed alone by api_crc_process.
+#define API_CRC_VECTOR_BLOCK_SIZE 64U	// Bytes of a block of api_crc_processv and api_crc_processStrided, the data is processed in whole blocks up to the end of the last segment.
+#define API_CRC_VECTOR_PART_SIZE 0x1FFFFFC0U	// Bytes of a segment processed at most by one call of api_crc_process, whole blocks below 2^29 bytes.
+
 //------------------------------------------------------------------------------
 // Private Enums
 //------------------------------------------------------------------------------
@@ -122,6 +155,16 @@
 // Private Types
 //------------------------------------------------------------------------------
 
+// Segment of the buffer for one thread of api_crc_processParallel.
+typedef struct
+{
+    api_crc_device_s const *device;
+    uint8_t const *buffer;
+    api_crc_state_t state;
+    uint32_t size;
+    uint8_t offset;
+} api_crc_segment_s;
+
 //------------------------------------------------------------------------------
 // Private Function Prototypes
 //------------------------------------------------------------------------------
@@ -130,6 +173,8 @@
 // Private Data
 //------------------------------------------------------------------------------
 
+static api_crc_engine_e api_crc_engine = API_CRC_ENGINE_AUTO;	// Engine selected by api_crc_setEngine.
+
 //------------------------------------------------------------------------------
 // Public Data
 //------------------------------------------------------------------------------
@@ -155,18 +200,497 @@
     // 4. startOffset = 7 und endOffset != 0
 
 
-static uint64_t api_crc_reverse64(uint64_t const value)
+
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+// Remainder of x^power modulo x^64 + polynomial, the polynomial is left aligned.
+static uint64_t api_crc_xPowerMod(uint16_t const power, uint64_t const polynomial)
+{
+    uint64_t remainder = 1U;
+    uint16_t counter = 0U;
+
+    for(counter = 0U; counter < power; counter++)
+    {
+        remainder = (remainder << 1U) ^ ((remainder >> 63U) ? (polynomial) : (0U));
+    }
+
+    return remainder;
+}
+#endif // OPTIMIZE
+
+// Product of two remainders modulo x^64 + polynomial, bit by bit.
+static uint64_t api_crc_multiplyMod(uint64_t const a, uint64_t const b, uint64_t const polynomial)
+{
+    uint64_t product = 0U;
+    uint8_t counter = 0U;
+
+    for(counter = 64U; counter > 0U; counter--)
+    {
+        product = (product << 1U) ^ ((product >> 63U) ? (polynomial) : (0U));
+        product ^= ((b >> (counter - 1U)) & 1U) ? (a) : (0U);
+    }
+
+    return product;
+}
+
+// Remainder of x^power modulo x^64 + polynomial by squaring and multiplying,
+// at most 64 squarings for any power.
+static uint64_t api_crc_xPowerModFast(uint64_t const power, uint64_t const polynomial)
+{
+    uint64_t remainder = 1U;
+    uint8_t counter = 0U;
+
+    // from the most significant set bit of the power
+    for(counter = (power == 0U) ? (0U) : (64U - __builtin_clzll(power)); counter > 0U; counter--)
+    {
+        remainder = api_crc_multiplyMod(remainder, remainder, polynomial);
+
+        if(((power >> (counter - 1U)) & 1U) != 0U)
+        {
+            remainder = (remainder << 1U) ^ ((remainder >> 63U) ? (polynomial) : (0U));
+        }
+    }
+
+    return remainder;
+}
+
+// Register of the device multiplied by a remainder modulo x^64 + x^(64-n) * P,
+// the register of the reverse processing is reflected for the multiplication.
+static uint64_t api_crc_multiplyRegister(api_crc_device_s const *const device, uint64_t const reg, uint64_t const factor)
+{
+    uint8_t const reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    uint64_t const polynomial = (reverse) ? (api_crc_reverse64(device->polynomial)) : (device->polynomial);
+    uint64_t const product = api_crc_multiplyMod((reverse) ? (api_crc_reverse64(reg)) : (reg), factor, polynomial);
+
+    return (reverse) ? (api_crc_reverse64(product)) : (product);
+}
+
+// Register of the device shifted over size zero bits, multiplied by x^size.
+static uint64_t api_crc_shiftRegister(api_crc_device_s const *const device, uint64_t const reg, uint64_t const size)
+{
+    uint64_t const polynomial = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+                                ? (api_crc_reverse64(device->polynomial)) : (device->polynomial);
+
+    return api_crc_multiplyRegister(device, reg, api_crc_xPowerModFast(size, polynomial));
+}
+
+// Product a * b modulo P of the order n, where low is P without the term x^n.
+static uint64_t api_crc_multiplyModOrder(uint64_t const a, uint64_t const b, uint64_t const low, uint8_t const order)
+{
+    uint64_t const mask = -1ULL >> ((sizeof(mask) << 3U) - order);
+    uint64_t product = 0U;
+    uint8_t counter = 0U;
+
+    for(counter = order; counter > 0U; counter--)
+    {
+        product = ((product << 1U) & mask) ^ ((((product >> (order - 1U)) & 1U) != 0U) ? (low) : (0U));
+        product ^= (((b >> (counter - 1U)) & 1U) != 0U) ? (a) : (0U);
+    }
+
+    return product;
+}
+
+// Remainder of x^-power modulo P by squaring and multiplying x^-1 = (P + 1) / x.
+// The inverse exists for the term x^0 of P, which api_crc_init always sets.
+static uint64_t api_crc_xInversePowerMod(api_crc_device_s const *const device, uint64_t const power)
+{
+    uint64_t const polynomial = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+                                ? (api_crc_reverse64(device->polynomial)) : (device->polynomial);
+    uint8_t const order = (sizeof(polynomial) << 3U) - (uint8_t)__builtin_ctzll(polynomial);
+    uint64_t const low = polynomial >> ((sizeof(polynomial) << 3U) - order);
+    uint64_t const inverse = (low >> 1U) | (1ULL << (order - 1U));
+    uint64_t remainder = 1U;
+    uint8_t counter = 0U;
+
+    for(counter = (power == 0U) ? (0U) : ((uint8_t)(64U - __builtin_clzll(power))); counter > 0U; counter--)
+    {
+        remainder = api_crc_multiplyModOrder(remainder, remainder, low, order);
+
+        if(((power >> (counter - 1U)) & 1U) != 0U)
+        {
+            remainder = api_crc_multiplyModOrder(remainder, inverse, low, order);
+        }
+    }
+
+    return remainder;
+}
+
+// Register of the device from the final CRC value, the inverse of api_crc_finalize.
+static uint64_t api_crc_restoreRegister(api_crc_device_s const *const device, api_crc_state_t const state)
+{
+    uint8_t order = 0U;
+    uint64_t reg = 0U;
+
+    // the zero bits of api_crc_finalize, the reflected polynomial has the term x^0 at the highest set bit
+    if(device->outputOrder == API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT)
+    {
+        order = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+                ? ((uint8_t)__builtin_clzll(device->polynomial)) : ((uint8_t)__builtin_ctzll(device->polynomial));
+    }
+
+    reg = state << order;
+
+    if(device->inputOrder != device->outputOrder)
+    {
+        reg = api_crc_reverse64(reg);
+    }
+
+    return reg ^ device->outputXOR;
+}
+
+// Thread of api_crc_processParallel, the segment is processed from its own register.
+static void *api_crc_processSegment(void *const argument)
+{
+    api_crc_segment_s *const segment = (api_crc_segment_s *)argument;
+
+    api_crc_process(segment->device, &segment->state, segment->buffer, segment->offset, segment->size);
+
+    return NULL;
+}
+
+
+// Registers of the lanes after the bytes of their messages. The lanes are
+// independent chains of lookups, which the CPU overlaps, up to the end of the
+// shortest message, the rest of each message follows alone.
+static inline __attribute__((always_inline)) void api_crc_processLanesOf(uint64_t const *const table, api_crc_register_t *const reg, uint8_t const *const *const data,
+        uint32_t const *const sizes, uint8_t const width, uint8_t const reverse)
+{
+    api_crc_register_t lanes[API_CRC_BATCH_LANES];
+    uint8_t const *bytes[API_CRC_BATCH_LANES];
+    uint32_t common = UINT32_MAX;
+    uint32_t index = 0U;
+    uint8_t lane = 0U;
+
+    for(lane = 0U; lane < API_CRC_BATCH_LANES; lane++)
+    {
+        lanes[lane] = reg[lane];
+        bytes[lane] = data[lane];
+        common = (sizes[lane] < common) ? (sizes[lane]) : (common);
+    }
+
+    for(index = 0U; index < common; index++)
+    {
+        for(lane = 0U; lane < API_CRC_BATCH_LANES; lane++)
+        {
+            lanes[lane] = api_crc_processByteOf(table, lanes[lane], bytes[lane][index], width, reverse);
+        }
+    }
+
+    for(lane = 0U; lane < API_CRC_BATCH_LANES; lane++)
+    {
+        for(index = common; index < sizes[lane]; index++)
+        {
+            lanes[lane] = api_crc_processByteOf(table, lanes[lane], bytes[lane][index], width, reverse);
+        }
+
+        reg[lane] = lanes[lane];
+    }
+}
+
+static void api_crc_processLanes(uint64_t const *const table, api_crc_register_t *const reg, uint8_t const *const *const data, uint32_t const *const sizes,
+                                 uint8_t const width, uint8_t const reverse)
+{
+    if(reverse != 0U)
+    {
+        switch(width)
+        {
+        case 1U:
+            api_crc_processLanesOf(table, reg, data, sizes, 1U, 1U);
+            break;
+        case 2U:
+            api_crc_processLanesOf(table, reg, data, sizes, 2U, 1U);
+            break;
+        case 4U:
+            api_crc_processLanesOf(table, reg, data, sizes, 4U, 1U);
+            break;
+        default:
+            api_crc_processLanesOf(table, reg, data, sizes, 8U, 1U);
+            break;
+        }
+    }
+    else
+    {
+        switch(width)
+        {
+        case 1U:
+            api_crc_processLanesOf(table, reg, data, sizes, 1U, 0U);
+            break;
+        case 2U:
+            api_crc_processLanesOf(table, reg, data, sizes, 2U, 0U);
+            break;
+        case 4U:
+            api_crc_processLanesOf(table, reg, data, sizes, 4U, 0U);
+            break;
+        default:
+            api_crc_processLanesOf(table, reg, data, sizes, 8U, 0U);
+            break;
+        }
+    }
+}
+
+// The blocks of width rows and columns right above and left below the diagonal
+// of the bit matrix are swapped, one step of the transposition.
+static inline __attribute__((always_inline)) void api_crc_transposeBlocks(uint64_t *const matrix, uint8_t const width, uint64_t const mask)
+{
+    uint64_t swap = 0U;
+    uint8_t block = 0U;
+    uint8_t row = 0U;
+
+    for(block = 0U; block < 64U; block += (width << 1U))
+    {
+        for(row = block; row < (block + width); row++)
+        {
+            swap = ((matrix[row] >> width) ^ matrix[row + width]) & mask;
+            matrix[row + width] ^= swap;
+            matrix[row] ^= swap << width;
+        }
+    }
+}
+
+// Transposes the bit matrix of 64 words in place, the bit i of the word j is
+// swapped with the bit j of the word i.
+static void api_crc_transpose64(uint64_t *const matrix)
+{
+    api_crc_transposeBlocks(matrix, 32U, 0x00000000FFFFFFFFULL);
+    api_crc_transposeBlocks(matrix, 16U, 0x0000FFFF0000FFFFULL);
+    api_crc_transposeBlocks(matrix, 8U, 0x00FF00FF00FF00FFULL);
+    api_crc_transposeBlocks(matrix, 4U, 0x0F0F0F0F0F0F0F0FULL);
+    api_crc_transposeBlocks(matrix, 2U, 0x3333333333333333ULL);
+    api_crc_transposeBlocks(matrix, 1U, 0x5555555555555555ULL);
+}
+
+// Registers of the lanes in the format of the state, from zero after the bits of
+// their messages. The messages end together, a message starts after the zero
+// bits, which the others are longer, the zero register stays zero over them. The
+// bit j of all registers is kept in the word j (a bit-plane), one step of the
+// planes over the next input bit of all messages moves the window of the planes
+// by one word and adds the feedback to the planes of the terms of the polynomial.
+static void api_crc_processSliced(api_crc_device_s const *const device, uint8_t const *const *const data, uint32_t const *const sizes, uint8_t const lanes,
+                                  uint64_t *const reg)
+{
+    uint64_t planes[API_CRC_SLICED_LANES + 64U];
+    uint64_t matrix[API_CRC_SLICED_LANES];
+    uint64_t words[API_CRC_SLICED_LANES][(API_CRC_SLICED_MAX_SIZE >> 6U) + 1U];
+    uint64_t feedback = 0U;
+    uint8_t const reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - ((reverse) ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial)));
+    uint8_t const low = (reverse) ? (0U) : ((sizeof(device->polynomial) << 3U) - order);
+    uint8_t const last = (reverse) ? (order - 1U) : (0U);
+    uint8_t taps[64U];
+    uint8_t count = 0U;
+    uint32_t longest = 0U;
+    uint64_t chunk = 0U;
+    uint32_t length = 0U;
+    uint32_t bytes = 0U;
+    uint32_t pad = 0U;
+    uint32_t byte = 0U;
+    uint32_t word = 0U;
+    uint8_t base = 0U;
+    uint8_t first = 0U;
+    uint8_t step = 0U;
+    uint8_t lane = 0U;
+    uint8_t tap = 0U;
+
+    // the terms of the polynomial, without the plane which takes the feedback
+    for(tap = 0U; tap < order; tap++)
+    {
+        if((tap != last) && (((device->polynomial >> (low + tap)) & 1U) != 0U))
+        {
+            taps[count++] = tap;
+        }
+    }
+
+    for(lane = 0U; lane < lanes; lane++)
+    {
+        longest = (sizes[lane] > longest) ? (sizes[lane]) : (longest);
+    }
+
+    length = ((longest + 63U) >> 6U) << 6U;
+
+    // the bits of each message in the order of the processing, aligned to the
+    // common end, the bits after the end of a message fall out of the words
+    for(lane = 0U; lane < API_CRC_SLICED_LANES; lane++)
+    {
+        for(word = 0U; word <= (length >> 6U); word++)
+        {
+            words[lane][word] = 0U;
+        }
+
+        bytes = (lane < lanes) ? ((sizes[lane] + 7U) >> 3U) : (0U);
+        pad = (lane < lanes) ? (length - sizes[lane]) : (0U);
+
+        for(byte = 0U; byte < bytes; byte += 8U)
+        {
+            chunk = 0U;
+
+            if((bytes - byte) >= 8U)
+            {
+                __builtin_memcpy(&chunk, &data[lane][byte], sizeof(chunk));
+            }
+            else
+            {
+                // without a branch on the length, the bytes after the end are masked
+                for(word = 0U; word < 8U; word++)
+                {
+                    chunk |= ((uint64_t)data[lane][(byte + word < bytes) ? (byte + word) : (byte)] & ((byte + word < bytes) ? (0xFFU) : (0U))) << (word << 3U);
+                }
+            }
+
+            word = (pad + (byte << 3U)) >> 6U;
+
+            if(reverse)
+            {
+                words[lane][word] |= chunk << (pad & 63U);
+                words[lane][word + 1U] |= ((pad & 63U) != 0U) ? (chunk >> (64U - (pad & 63U))) : (0U);
+            }
+            else
+            {
+                chunk = __builtin_bswap64(chunk);
+                words[lane][word] |= chunk >> (pad & 63U);
+                words[lane][word + 1U] |= ((pad & 63U) != 0U) ? (chunk << (64U - (pad & 63U))) : (0U);
+            }
+        }
+    }
+
+    // the steps before the longest message are zero for all lanes, they are skipped
+    first = length - longest;
+    base = (reverse) ? (first) : (64U - first);
+
+    for(tap = 0U; tap < order; tap++)
+    {
+        planes[base + tap] = 0U;
+    }
+
+    for(word = 0U; word < (length >> 6U); word++)
+    {
+        for(lane = 0U; lane < API_CRC_SLICED_LANES; lane++)
+        {
+            matrix[lane] = words[lane][word];
+        }
+
+        // the word i of the matrix holds the input bit i of all lanes, the first
+        // bit is the least significant (reverse) or the most significant (forward)
+        api_crc_transpose64(matrix);
+
+        if(reverse)
+        {
+            for(step = first; step < 64U; step++)
+            {
+                feedback = planes[base] ^ matrix[step];
+                base++;
+                planes[base + last] = feedback;
+
+                for(tap = 0U; tap < count; tap++)
+                {
+                    planes[base + taps[tap]] ^= feedback;
+                }
+            }
+
+            // the window of the planes back to its start
+            for(tap = 0U; tap < order; tap++)
+            {
+                planes[tap] = planes[64U + tap];
+            }
+
+            base = 0U;
+        }
+        else
+        {
+            for(step = first; step < 64U; step++)
+            {
+                feedback = planes[base + order - 1U] ^ matrix[63U - step];
+                base--;
+                planes[base] = feedback;
+
+                for(tap = 0U; tap < count; tap++)
+                {
+                    planes[base + taps[tap]] ^= feedback;
+                }
+            }
+
+            for(tap = 0U; tap < order; tap++)
+            {
+                planes[64U + tap] = planes[tap];
+            }
+
+            base = 64U;
+        }
+
+        first = 0U;
+    }
+
+    for(tap = 0U; tap < API_CRC_SLICED_LANES; tap++)
+    {
+        matrix[tap] = (tap < order) ? (planes[base + tap]) : (0U);
+    }
+
+    api_crc_transpose64(matrix);
+
+    for(lane = 0U; lane < lanes; lane++)
+    {
+        reg[lane] = matrix[lane] << low;
+    }
+}
+
+// Constants for the carry-less multiplication: the folding distances of 128 to
+// 2048 bits and for the Barrett reduction mu = x^128 / P. The register of both
+// orders is a 64-bit CRC with the polynomial x^(64-n) * P, the reflected
+// constants are shifted by one bit as the carry-less product of two reflected
+// 64-bit values is a reflected value of 127 bits. Only the build for performance
+// folds, the build for code size keeps the constants of the Barrett reduction.
+#if (API_CRC_FOLD_SIZE > 0U)
+static void api_crc_foldConstants(api_crc_device_s *const device)
 {
-    uint64_t temp = value;
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+    // distances in the order of the enumeration api_crc_fold_e
+    static uint16_t const distances[] = {128U, 256U, 384U, 512U, 1024U, 1536U, 2048U};
+    uint16_t distance = 0U;
+#endif // OPTIMIZE
+    uint8_t const reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    uint64_t const polynomial = (reverse) ? (api_crc_reverse64(device->polynomial)) : (device->polynomial);
+    uint64_t remainder = 0U;
+    uint64_t mu = 0U;
+    uint8_t counter = 0U;
+    uint8_t top = 0U;
+
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+    for(counter = 0U; counter < (sizeof(distances) / sizeof(distances[0U])); counter++)
+    {
+        distance = distances[counter];
+
+        if(reverse)
+        {
+            device->fold[API_CRC_FOLD_128_LOW + (counter << 1U)] = api_crc_reverse64(api_crc_xPowerMod(distance + 63U, polynomial));
+            device->fold[API_CRC_FOLD_128_HIGH + (counter << 1U)] = api_crc_reverse64(api_crc_xPowerMod(distance - 1U, polynomial));
+        }
+        else
+        {
+            device->fold[API_CRC_FOLD_128_LOW + (counter << 1U)] = api_crc_xPowerMod(distance, polynomial);
+            device->fold[API_CRC_FOLD_128_HIGH + (counter << 1U)] = api_crc_xPowerMod(distance + 64U, polynomial);
+        }
+    }
+#endif // OPTIMIZE
+
+    // long division of x^128, the quotient has 65 bits (x^64 is omitted)
+    for(counter = 0U; counter <= 128U; counter++)
+    {
+        top = (uint8_t)(remainder >> 63U);
+        remainder = (remainder << 1U) | (counter == 0U);
+        remainder ^= (top) ? (polynomial) : (0U);
+        mu = (mu << 1U) | top;
+    }
 
-    temp = ((temp >>  1U) & 0x5555555555555555U) | ((temp & 0x5555555555555555U) <<  1U);
-    temp = ((temp >>  2U) & 0x3333333333333333U) | ((temp & 0x3333333333333333U) <<  2U);
-    temp = ((temp >>  4U) & 0x0F0F0F0F0F0F0F0FU) | ((temp & 0x0F0F0F0F0F0F0F0FU) <<  4U);
-    temp = ((temp >>  8U) & 0x00FF00FF00FF00FFU) | ((temp & 0x00FF00FF00FF00FFU) <<  8U);
-    temp = ((temp >> 16U) & 0x0000FFFF0000FFFFU) | ((temp & 0x0000FFFF0000FFFFU) << 16U);
-    temp = ((temp >> 32U) & 0x00000000FFFFFFFFU) | ((temp & 0x00000000FFFFFFFFU) << 32U);
-    return temp;
+    if(reverse)
+    {
+        device->fold[API_CRC_FOLD_MU] = api_crc_reverse64((1ULL << 63U) | (mu >> 1U));
+        device->fold[API_CRC_FOLD_POLYNOMIAL] = api_crc_reverse64((1ULL << 63U) | (polynomial >> 1U));
+    }
+    else
+    {
+        device->fold[API_CRC_FOLD_MU] = mu;
+        device->fold[API_CRC_FOLD_POLYNOMIAL] = polynomial;
+    }
 }
+#endif // API_CRC_FOLD_SIZE
 
 
 // TODO Preprocessor decision, register shall be used for internal processing,
@@ -182,49 +706,49 @@ static uint64_t api_crc_reverse64(uint64_t const value)
 
 static api_crc_register_t api_crc_readForwardTable08(uint64_t const *const table, uint8_t const index)
 {
-    return (((api_crc_register_t)(((uint8_t const *const)table)[index])) << ((sizeof(api_crc_register_t) - sizeof(uint8_t)) << 3U));
+    return api_crc_readEntry(table, sizeof(uint8_t), index) << ((sizeof(api_crc_register_t) - sizeof(uint8_t)) << 3U);
 }
 
 
 static api_crc_register_t api_crc_readForwardTable16(uint64_t const *const table, uint8_t const index)
 {
-    return (((api_crc_register_t)(((uint16_t const *const)table)[index])) << ((sizeof(api_crc_register_t) - sizeof(uint16_t)) << 3U));
+    return api_crc_readEntry(table, sizeof(uint16_t), index) << ((sizeof(api_crc_register_t) - sizeof(uint16_t)) << 3U);
 }
 
 
 static api_crc_register_t api_crc_readForwardTable32(uint64_t const *const table, uint8_t const index)
 {
-    return (((api_crc_register_t)(((uint32_t const *const)table)[index])) << ((sizeof(api_crc_register_t) - sizeof(uint32_t)) << 3U));
+    return api_crc_readEntry(table, sizeof(uint32_t), index) << ((sizeof(api_crc_register_t) - sizeof(uint32_t)) << 3U);
 }
 
 #ifdef PLATFORM_X86_64
 static api_crc_register_t api_crc_readForwardTable64(uint64_t const *const table, uint8_t const index)
 {
-    return (((api_crc_register_t)(((uint64_t const *const)table)[index])) << ((sizeof(api_crc_register_t) - sizeof(uint64_t)) << 3U));
+    return api_crc_readEntry(table, sizeof(uint64_t), index) << ((sizeof(api_crc_register_t) - sizeof(uint64_t)) << 3U);
 }
 #endif
 
 static api_crc_register_t api_crc_readReverseTable08(uint64_t const *const table, uint8_t const index)
 {
-    return ((api_crc_register_t)(((uint8_t const *const)table)[index]));
+    return api_crc_readEntry(table, sizeof(uint8_t), index);
 }
 
 
 static api_crc_register_t api_crc_readReverseTable16(uint64_t const *const table, uint8_t const index)
 {
-    return ((api_crc_register_t)(((uint16_t const *const)table)[index]));
+    return api_crc_readEntry(table, sizeof(uint16_t), index);
 }
 
 
 static api_crc_register_t api_crc_readReverseTable32(uint64_t const *const table, uint8_t const index)
 {
-    return ((api_crc_register_t)(((uint32_t const *const)table)[index]));
+    return api_crc_readEntry(table, sizeof(uint32_t), index);
 }
 
 #ifdef PLATFORM_X86_64
 static api_crc_register_t api_crc_readReverseTable64(uint64_t const *const table, uint8_t const index)
 {
-    return ((api_crc_register_t)(((uint64_t const *const)table)[index]));
+    return api_crc_readEntry(table, sizeof(uint64_t), index);
 }
 #endif
 
@@ -276,35 +800,224 @@ static void api_crc_writeReverseTable64(api_crc_register_t const reg, uint64_t *
 }
 #endif
 
-static uint16_t api_crc_order2Size(uint8_t const order)
+// Functions to read and write the entries of the tables of the device, the width
+// of the entries follows from the order of the polynomial.
+static void api_crc_tableAccess(api_crc_device_s const *const device, api_crc_register_t (**const api_crc_readTable)(uint64_t const *const, uint8_t const),
+                                void (**const api_crc_writeTable)(api_crc_register_t const, uint64_t *const, uint8_t const))
 {
-    uint16_t size = 0;
+    uint8_t order = 0U;
 
-    if(order <= 8U)
-    {
-        size = 1U << 8U;
-    }
-    else if(order <= 16)
-    {
-        size = 2U << 8U;
-    }
-    else if(order <= 32)
-    {
-        size = 4U << 8U;
-    }
-    else if(order <= 64)
+    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
     {
-        size = 8U << 8U;
+        order = (sizeof(device->polynomial) << 3U) - __builtin_clzll(device->polynomial);
+
+        if(order <= 8U)
+        {
+            (*api_crc_readTable) = api_crc_readReverseTable08;
+            (*api_crc_writeTable) = api_crc_writeReverseTable08;
+        }
+        else if(order <= 16U)
+        {
+            (*api_crc_readTable) = api_crc_readReverseTable16;
+            (*api_crc_writeTable) = api_crc_writeReverseTable16;
+        }
+        else if(order <= 32U)
+        {
+            (*api_crc_readTable) = api_crc_readReverseTable32;
+            (*api_crc_writeTable) = api_crc_writeReverseTable32;
+        }
+#ifdef PLATFORM_X86_64
+        else if(order <= 64U)
+        {
+            (*api_crc_readTable) = api_crc_readReverseTable64;
+            (*api_crc_writeTable) = api_crc_writeReverseTable64;
+        }
+#endif
+        else
+        {
+            // Not possible as the biggest possible register type consists of at
+            // most 64 bits.
+        }
     }
     else
     {
-        // Not possible as the biggest possible register type consists of at
-        // most 64 bits.
-        size = 0;
-    }
-
-    return size;
-}
+        order = (sizeof(device->polynomial) << 3U) - __builtin_ctzll(device->polynomial);
+
+        if(order <= 8U)
+        {
+            (*api_crc_readTable) = api_crc_readForwardTable08;
+            (*api_crc_writeTable) = api_crc_writeForwardTable08;
+        }
+        else if(order <= 16U)
+        {
+            (*api_crc_readTable) = api_crc_readForwardTable16;
+            (*api_crc_writeTable) = api_crc_writeForwardTable16;
+        }
+        else if(order <= 32U)
+        {
+            (*api_crc_readTable) = api_crc_readForwardTable32;
+            (*api_crc_writeTable) = api_crc_writeForwardTable32;
+        }
+#ifdef PLATFORM_X86_64
+        else if(order <= 64U)
+        {
+            (*api_crc_readTable) = api_crc_readForwardTable64;
+            (*api_crc_writeTable) = api_crc_writeForwardTable64;
+        }
+#endif
+        else
+        {
+            // Not possible as the biggest possible register type consists of at
+            // most 64 bits.
+        }
+    }
+}
+
+static uint16_t api_crc_order2Size(uint8_t const order)
+{
+    uint16_t size = 0;
+
+    if(order <= 8U)
+    {
+        size = 1U << 8U;
+    }
+    else if(order <= 16)
+    {
+        size = 2U << 8U;
+    }
+    else if(order <= 32)
+    {
+        size = 4U << 8U;
+    }
+    else if(order <= 64)
+    {
+        size = 8U << 8U;
+    }
+    else
+    {
+        // Not possible as the biggest possible register type consists of at
+        // most 64 bits.
+        size = 0;
+    }
+
+    return size;
+}
+
+static uint8_t api_crc_type2Slices(api_crc_table_e const type)
+{
+    uint8_t slices = 0U;
+
+    switch(type)
+    {
+    case API_CRC_TABLE_BYTE:
+        slices = 1U;
+        break;
+    case API_CRC_TABLE_SLICING_BY_8:
+        slices = 8U;
+        break;
+    case API_CRC_TABLE_SLICING_BY_16:
+        slices = 16U;
+        break;
+    case API_CRC_TABLE_NIBBLE:
+        slices = 1U;
+        break;
+    case API_CRC_TABLE_WORD:
+        // two tables are generated, they are merged to the one of two bytes
+        slices = 2U;
+        break;
+    default:
+        // Unknown layout of the table.
+        slices = 0U;
+        break;
+    }
+
+    return slices;
+}
+
+// Size of the table of the given layout in bytes, the size of one table of 256
+// entries is given.
+static uint32_t api_crc_type2Size(uint16_t const sizeofSlice, api_crc_table_e const type)
+{
+    uint32_t size = (uint32_t)sizeofSlice * api_crc_type2Slices(type);
+
+    if(type == API_CRC_TABLE_NIBBLE)
+    {
+        size = (uint32_t)sizeofSlice >> 4U;
+    }
+    else if(type == API_CRC_TABLE_WORD)
+    {
+        size = (uint32_t)sizeofSlice << 8U;
+    }
+
+    return size;
+}
+
+#ifndef API_CRC_CLMUL
+// Engines supported by the CPU as bits (1 << api_crc_engine_e), the build uses
+// no instructions of the CPU beyond the lookup table.
+static uint8_t api_crc_supportedEngines(void)
+{
+    return (1U << API_CRC_ENGINE_TABLE);
+}
+#endif // API_CRC_CLMUL
+
+// An engine is used, if the CPU supports it and it is permitted by the selection.
+// The selection is read atomically, it may be changed by another thread.
+static uint8_t api_crc_isEngineEnabled(api_crc_engine_e const engine)
+{
+    api_crc_engine_e const selected = __atomic_load_n(&api_crc_engine, __ATOMIC_RELAXED);
+
+    return ((api_crc_supportedEngines() & (1U << engine)) != 0U) && ((selected == API_CRC_ENGINE_AUTO) || (engine <= selected));
+}
+
+// Checks whether the process for the given layout of the table is part of this build.
+static uint8_t api_crc_isTableSupported(api_crc_table_e const type)
+{
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+    return (api_crc_type2Slices(type) != 0U);
+#elif (OPTIMIZE == BUILD_FOR_DATA)
+    return ((type == API_CRC_TABLE_BYTE) || (type == API_CRC_TABLE_NIBBLE));
+#else
+    return (type == API_CRC_TABLE_BYTE);
+#endif // OPTIMIZE
+}
+
+// Table of two bytes from the tables of one byte (row 0) and of one byte followed
+// by a zero byte (row 1): The entry of the row r and column c is A[r] ^ B[c],
+// the first byte selects A (row 1), the second byte B (row 0). The first byte is
+// the row for the forward and the column for the reverse processing. The rows 0
+// and 1 are overwritten at last.
+static void api_crc_tableWord(api_crc_device_s const *const device, uint64_t *const table, uint32_t const sizeofSlice,
+                              api_crc_register_t (*const api_crc_readTable)(uint64_t const *const, uint8_t const),
+                              void (*const api_crc_writeTable)(api_crc_register_t const, uint64_t *const, uint8_t const))
+{
+    uint8_t const reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    uint64_t *const rowA = (reverse) ? (&table[0U]) : (&table[sizeofSlice]);
+    uint64_t *const rowB = (reverse) ? (&table[sizeofSlice]) : (&table[0U]);
+    api_crc_register_t entryA = 0U;
+    api_crc_register_t entryB = 0U;
+    uint16_t row = 0U;
+    uint16_t column = 0U;
+
+    for(row = 255U; row >= 2U; row--)
+    {
+        entryA = api_crc_readTable(rowA, row);
+
+        for(column = 0U; column <= 255U; column++)
+        {
+            api_crc_writeTable(entryA ^ api_crc_readTable(rowB, column), &table[row * sizeofSlice], column);
+        }
+    }
+
+    entryA = api_crc_readTable(rowA, 1U);
+
+    for(column = 0U; column <= 255U; column++)
+    {
+        entryB = api_crc_readTable(rowB, column);
+        api_crc_writeTable(entryB, &table[0U], column);
+        api_crc_writeTable(entryA ^ entryB, &table[sizeofSlice], column);
+    }
+}
 
 #if (OPTIMIZE != BUILD_FOR_PERFORM)
 static void api_crc_processForwardBit(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint8_t const offset, uint32_t const size)
@@ -424,8 +1137,221 @@ static void api_crc_processReverseLUT(api_crc_device_s const *const device, api_
     }
 }
 
+#if (OPTIMIZE == BUILD_FOR_SIZE)
+
+
+// Barrett reduction of 64 input bits per step with the constants of the folding,
+// no table is used. Returns the number of processed bytes, a multiple of 8.
+static uint32_t api_crc_processForwardBarrett(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const mu = device->fold[API_CRC_FOLD_MU];
+    uint64_t const polynomial = device->fold[API_CRC_FOLD_POLYNOMIAL];
+    uint64_t crc = (*reg);
+    uint64_t quotient = 0U;
+    uint32_t counter = 0U;
+    uint8_t index = 0U;
+
+    for(counter = 0U; (counter + 8U) <= size; counter += 8U)
+    {
+        for(index = 0U; index < 8U; index++)
+        {
+            crc ^= (uint64_t)buffer[counter + index] << ((7U - index) << 3U);
+        }
+
+        quotient = crc ^ api_crc_clmulHigh(crc, mu);
+        crc = api_crc_clmulLow(quotient, polynomial);
+    }
+
+    (*reg) = (api_crc_register_t)crc;
+    return counter;
+}
+
+static uint32_t api_crc_processReverseBarrett(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const mu = device->fold[API_CRC_FOLD_MU];
+    uint64_t const polynomial = device->fold[API_CRC_FOLD_POLYNOMIAL];
+    // term x^0 of the polynomial x^(64-n) * P, set only for a CRC-64
+    uint64_t const constant = (uint64_t)0U - ((uint64_t)device->polynomial >> 63U);
+    uint64_t crc = (*reg);
+    uint64_t quotient = 0U;
+    uint32_t counter = 0U;
+    uint8_t index = 0U;
+
+    for(counter = 0U; (counter + 8U) <= size; counter += 8U)
+    {
+        for(index = 0U; index < 8U; index++)
+        {
+            crc ^= (uint64_t)buffer[counter + index] << (index << 3U);
+        }
+
+        quotient = api_crc_clmulLow(crc, mu);
+        crc = api_crc_clmulHigh(quotient, polynomial) ^ (quotient & constant);
+    }
+
+    (*reg) = (api_crc_register_t)crc;
+    return counter;
+}
+#endif // OPTIMIZE
+
+#if (OPTIMIZE == BUILD_FOR_DATA)
+
+static void api_crc_processForwardNibble(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - __builtin_ctzll(device->polynomial);
+
+    if(order <= 8U)
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint8_t), buffer, size);
+    }
+    else if(order <= 16U)
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint16_t), buffer, size);
+    }
+    else if(order <= 32U)
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint32_t), buffer, size);
+    }
+    else
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint64_t), buffer, size);
+    }
+}
+
+
+static void api_crc_processReverseNibble(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - __builtin_clzll(device->polynomial);
+
+    if(order <= 8U)
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint8_t), buffer, size);
+    }
+    else if(order <= 16U)
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint16_t), buffer, size);
+    }
+    else if(order <= 32U)
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint32_t), buffer, size);
+    }
+    else
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint64_t), buffer, size);
+    }
+}
+#endif // OPTIMIZE
+
 #endif // OPTIMIZE
 
+// The segments of an I/O vector, or without a vector the rows of size bytes in
+// the distance of pitch bytes, are processed as one contiguous data. The whole
+// blocks are processed in place, the rest of a segment waits in a block for the
+// next segments. The arguments are checked before.
+static api_crc_status_e api_crc_processSegments(api_crc_device_s const *const device, api_crc_state_t *const state, struct iovec const *const vector,
+        uint8_t const *const buffer, uint64_t const size, uint64_t const pitch, uint32_t const count)
+{
+    uint8_t block[API_CRC_VECTOR_BLOCK_SIZE];
+    uint8_t const *data = NULL;
+    uint64_t left = 0U;
+    uint64_t part = 0U;
+    uint32_t segment = 0U;
+    uint8_t filled = 0U;
+#ifdef API_CRC_CLMUL
+    api_crc_register_t reg = 0U;
+    uint64_t total = (uint64_t)size * count;
+    uint64_t longest = size;
+#endif // API_CRC_CLMUL
+
+#ifndef API_CRC_IOVEC
+    (void)vector;
+#endif // API_CRC_IOVEC
+#ifdef API_CRC_CLMUL
+
+#ifdef API_CRC_IOVEC
+    for(segment = 0U; (vector != NULL) && (segment < count); segment++)
+    {
+        total += vector[segment].iov_len;
+        longest = (vector[segment].iov_len > longest) ? (vector[segment].iov_len) : (longest);
+    }
+#endif // API_CRC_IOVEC
+
+    // The lanes of the instructions of the CPU are folded over the boundaries of
+    // the segments, the long segments are left to the wide instructions.
+    if((device->tableType == API_CRC_TABLE_BYTE) && (device->table != NULL) && (total >= API_CRC_CLMUL_MIN_SIZE)
+            && (device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U) && (api_crc_isEngineEnabled(API_CRC_ENGINE_CLMUL))
+            && ((longest < API_CRC_VPCLMUL_MIN_SIZE) || (!api_crc_isEngineEnabled(API_CRC_ENGINE_VPCLMUL)))
+            && (!((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+                  && (device->polynomial == API_CRC_CRC32C_POLYNOMIAL) && (api_crc_isEngineEnabled(API_CRC_ENGINE_CRC32C)))))
+    {
+        reg = api_crc_stateRegister(device, (*state));
+#ifdef API_CRC_IOVEC
+        if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+        {
+            filled = (vector != NULL) ? (api_crc_processReverseCLMULv(device, &reg, vector, count, block))
+                     : (api_crc_processReverseCLMULStrided(device, &reg, buffer, size, pitch, count, block));
+        }
+        else
+        {
+            filled = (vector != NULL) ? (api_crc_processForwardCLMULv(device, &reg, vector, count, block))
+                     : (api_crc_processForwardCLMULStrided(device, &reg, buffer, size, pitch, count, block));
+        }
+#else
+        filled = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+                 ? (api_crc_processReverseCLMULStrided(device, &reg, buffer, size, pitch, count, block))
+                 : (api_crc_processForwardCLMULStrided(device, &reg, buffer, size, pitch, count, block));
+#endif // API_CRC_IOVEC
+        (*state) = api_crc_registerState(device, reg);
+
+        return api_crc_process(device, state, block, 0U, (uint32_t)filled << 3U);
+    }
+#endif // API_CRC_CLMUL
+
+    for(segment = 0U; segment < count; segment++)
+    {
+#ifdef API_CRC_IOVEC
+        data = (vector != NULL) ? ((uint8_t const *)vector[segment].iov_base) : (&buffer[segment * pitch]);
+        left = (vector != NULL) ? (vector[segment].iov_len) : (size);
+#else
+        data = &buffer[segment * pitch];
+        left = size;
+#endif // API_CRC_IOVEC
+
+        // the block of the rest of the previous segments first
+        if((filled != 0U) && (left != 0U))
+        {
+            part = ((uint64_t)(API_CRC_VECTOR_BLOCK_SIZE - filled) < left) ? ((uint64_t)(API_CRC_VECTOR_BLOCK_SIZE - filled)) : (left);
+            __builtin_memcpy(&block[filled], data, part);
+            filled += (uint8_t)part;
+            data += part;
+            left -= part;
+
+            if(filled == API_CRC_VECTOR_BLOCK_SIZE)
+            {
+                api_crc_process(device, state, block, 0U, API_CRC_VECTOR_BLOCK_SIZE << 3U);
+                filled = 0U;
+            }
+        }
+
+        // the whole blocks in place
+        while(left >= API_CRC_VECTOR_BLOCK_SIZE)
+        {
+            part = (left < API_CRC_VECTOR_PART_SIZE) ? (left & ~((uint64_t)API_CRC_VECTOR_BLOCK_SIZE - 1U)) : (API_CRC_VECTOR_PART_SIZE);
+            api_crc_process(device, state, data, 0U, (uint32_t)(part << 3U));
+            data += part;
+            left -= part;
+        }
+
+        // the rest waits in the block for the next segments
+        if(left != 0U)
+        {
+            __builtin_memcpy(&block[filled], data, left);
+            filled += (uint8_t)left;
+        }
+    }
+
+    return api_crc_process(device, state, block, 0U, (uint32_t)filled << 3U);
+}
+
 //------------------------------------------------------------------------------
 // Public Functions
 //------------------------------------------------------------------------------
@@ -610,11 +1536,12 @@ api_crc_status_e api_crc_init(uint64_t const polynomial, uint64_t const inputXOR
         return API_CRC_STATUS_INVALID_PARAMETER;
     }
 
-    device->polynomial = (((polynomial & (-1ULL >> (order + 1))) << 1U) | 1U) << zeroes;
+    device->polynomial = (((polynomial & (-1ULL >> (zeroes + 1U))) << 1U) | 1U) << zeroes;
     device->inputXOR = inputXOR << zeroes;
     device->table = table;
     device->inputOrder = inputOrder;
     device->outputOrder = outputOrder;
+    device->tableType = API_CRC_TABLE_BYTE;
 
     if(inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
     {
@@ -642,6 +1569,10 @@ api_crc_status_e api_crc_init(uint64_t const polynomial, uint64_t const inputXOR
         }
     }
 
+#if (API_CRC_FOLD_SIZE > 0U)
+    api_crc_foldConstants(device);
+#endif // API_CRC_FOLD_SIZE
+
     return API_CRC_STATUS_SUCCESS;
 }
 
@@ -665,6 +1596,8 @@ api_crc_status_e api_crc_init(uint64_t const polynomial, uint64_t const inputXOR
 //! \param[in] size The size of the table in bytes. To explore the proper size of the table,
 //! it is strongly discouraged to use the function api_crc_sizeofTable(polynomial).
 //! For example, for polynomial CRC-16 (0xC002) is size of table = 512 bytes.
+//! The function fills the byte-wise table only, the other layouts of the table
+//! are filled by ::api_crc_tableOfType.
 //!
 //! \retval ::API_CRC_STATUS_SUCCESS Exclusive access has been granted.
 //! \retval ::API_CRC_STATUS_INVALID_PARAMETER Provided parameter(s) are invalid.
@@ -736,87 +1669,7 @@ api_crc_status_e api_crc_init(uint64_t const polynomial, uint64_t const inputXOR
 //------------------------------------------------------------------------------
 api_crc_status_e api_crc_table(api_crc_device_s *device, uint64_t *const table, uint16_t size)
 {
-    api_crc_register_t reg = 0;
-    void (*api_crc_processBit)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint8_t const, uint32_t const) = 0U;
-    void (*api_crc_writeTable)(api_crc_register_t const reg, uint64_t *const table, uint8_t const index) = 0U;
-    uint16_t counter = 0;
-    uint8_t order = 0;
-
-    if((device == 0) || (table == 0)
-            || (size != api_crc_order2Size((sizeof(device->polynomial) << 3U) - ((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial))))))
-    {
-        return API_CRC_STATUS_INVALID_PARAMETER;
-    }
-//    printf("Size of Table is %d\n", api_crc_order2Size((sizeof(device->polynomial) << 3U) - ((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial)))));
-
-    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
-    {
-        api_crc_processBit = api_crc_processReverseBit;
-        order = (sizeof(device->polynomial) << 3U) - __builtin_clzll(device->polynomial);
-
-        if(order <= 8U)
-        {
-            api_crc_writeTable = api_crc_writeReverseTable08;
-        }
-        else if(order <= 16U)
-        {
-            api_crc_writeTable = api_crc_writeReverseTable16;
-        }
-        else if(order <= 32U)
-        {
-            api_crc_writeTable = api_crc_writeReverseTable32;
-        }
-#ifdef PLATFORM_X86_64
-        else if(order <= 64U)
-        {
-            api_crc_writeTable = api_crc_writeReverseTable64;
-        }
-#endif
-        else
-        {
-            // Not possible as the biggest possible register type consists of at
-            // most 64 bits.
-        }
-    }
-    else
-    {
-        api_crc_processBit = api_crc_processForwardBit;
-        order = (sizeof(device->polynomial) << 3U) - __builtin_ctzll(device->polynomial);
-
-        if(order <= 8U)
-        {
-            api_crc_writeTable = api_crc_writeForwardTable08;
-        }
-        else if(order <= 16U)
-        {
-            api_crc_writeTable = api_crc_writeForwardTable16;
-        }
-        else if(order <= 32U)
-        {
-            api_crc_writeTable = api_crc_writeForwardTable32;
-        }
-#ifdef PLATFORM_X86_64
-        else if(order <= 64U)
-        {
-            api_crc_writeTable = api_crc_writeForwardTable64;
-        }
-#endif
-        else
-        {
-            // Not possible as the biggest possible register type consists of at
-            // most 64 bits.
-        }
-    }
-
-    for(counter = 0; counter <= 255; counter++)
-    {
-        reg = 0U;
-        api_crc_processBit(device, &reg, (uint8_t *)&counter, 0, 8);
-        api_crc_writeTable(reg, table, counter);
-    }
-
-    device->table = table;
-    return API_CRC_STATUS_SUCCESS;
+    return api_crc_tableOfType(device, table, size, API_CRC_TABLE_BYTE);
 }
 
 
@@ -882,12 +1735,328 @@ uint16_t api_crc_sizeofTable(uint64_t const polynomial)
 //------------------------------------------------------------------------------
 //!
 //! \brief
-//! The method used to api_crc_reset cleaning of old data.
+//! The function fills the lookup table of the given layout with the previously calculated values.
 //!
 //! \details
-//! The function resets the variable state to initial value, i.e. state = device.inputXOR
-//!
-//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//! - The width of the table entries is decided by the width of the generator polynomial
+//! in the same way as for the function ::api_crc_table.
+//! - ::API_CRC_TABLE_BYTE fills one table of 256 entries (same as ::api_crc_table).
+//! - ::API_CRC_TABLE_SLICING_BY_8 and ::API_CRC_TABLE_SLICING_BY_16 fill 8 or 16 consecutive
+//! tables of 256 entries. The table k holds the remainder of a byte followed by k zero bytes,
+//! the first table is the same as the one of ::API_CRC_TABLE_BYTE.
+//! The function ::api_crc_process then processes 8 or 16 input bytes per iteration.
+//! - ::API_CRC_TABLE_NIBBLE fills one table of 16 entries, the remainders of a half byte.
+//! The function ::api_crc_process then needs two lookups per input byte.
+//! - ::API_CRC_TABLE_WORD fills one table of 65536 entries, the remainders of two bytes
+//! (128 KB to 512 KB). The table is merged from the tables of slicing-by-2 and filled
+//! in less than a millisecond. The function ::api_crc_process then needs one lookup per
+//! two input bytes, the lookup hits the L2 cache, however.
+//! - The type of the table is stored in the device (::api_crc_device_s.tableType).
+//!
+//! \param[in,out] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given
+//! parameters.
+//!
+//! \param[in,out] *table Pointer to address space containing a suitably sized lookup
+//! table. For example, uint32_t table[8][256] for slicing-by-8 of CRC-32.
+//!
+//! \param[in] size The size of the table in bytes, see ::api_crc_sizeofTableOfType.
+//!
+//! \param[in] type ::api_crc_table_e Layout of the lookup table.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS Exclusive access has been granted.
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER Provided parameter(s) are invalid.
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED The layout of the table is not supported by this build.
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_tableOfType"];
+//!
+//! CALLER=>FU[label = "api_crc_tableOfType(&device,table,size,type)"];
+//!
+//! FU=>FU[label = "(device == 0)||(table == 0)||(size != api_crc_sizeofTableOfType())"];
+//!
+//! FU>>CALLER[label = "API_CRC_STATUS_INVALID_PARAMETER", linecolor = "red"];
+//!
+//! FU>>CALLER[label = "API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! api_crc_device_s device;
+//! uint32_t table32[8][256];
+//! uint32_t table_size = api_crc_sizeofTableOfType(0x82608EDB, API_CRC_TABLE_SLICING_BY_8);
+//!
+//! // init of the device
+//! if (api_crc_init(0x82608EDB, 0xFFFFFFFF, 0xFFFFFFFF, 0U, inputOrder, outputOrder, &device) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//!
+//! // Filling in the tables for slicing-by-8
+//! if (api_crc_tableOfType(&device, (uint64_t*) table32, table_size, API_CRC_TABLE_SLICING_BY_8) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! ...
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_init must be called before the function ::api_crc_tableOfType.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The slicing tables are processed only by the library built with BUILD_FOR_PERFORM,
+//! the table of half bytes by the library built with BUILD_FOR_PERFORM or BUILD_FOR_DATA,
+//! the table of two bytes by the library built with BUILD_FOR_PERFORM. The size of the
+//! table of two bytes exceeds the argument of the function ::api_crc_table.
+//!
+//! \warning
+//! Nothing.
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_tableOfType(api_crc_device_s *const device, uint64_t *const table, uint32_t const size, api_crc_table_e const type)
+{
+    api_crc_register_t reg = 0;
+    void (*api_crc_processBit)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint8_t const, uint32_t const) = 0U;
+    api_crc_register_t (*api_crc_readTable)(uint64_t const *const, uint8_t const) = 0U;
+    void (*api_crc_writeTable)(api_crc_register_t const reg, uint64_t *const table, uint8_t const index) = 0U;
+    uint32_t sizeofSlice = 0U;
+    uint16_t counter = 0;
+    uint8_t slice = 0U;
+    uint8_t nibble = 0U;
+
+    if((device == 0) || (table == 0) || (api_crc_type2Slices(type) == 0U))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    sizeofSlice = api_crc_order2Size((sizeof(device->polynomial) << 3U) - ((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial))));
+
+    if(size != api_crc_type2Size(sizeofSlice, type))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    if(!api_crc_isTableSupported(type))
+    {
+        return API_CRC_STATUS_NOT_SUPPORTED;
+    }
+
+    api_crc_processBit = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (api_crc_processReverseBit) : (api_crc_processForwardBit);
+    api_crc_tableAccess(device, &api_crc_readTable, &api_crc_writeTable);
+
+    if(type == API_CRC_TABLE_NIBBLE)
+    {
+        // The half byte is the first one to be processed of the byte.
+        for(counter = 0; counter <= 15; counter++)
+        {
+            reg = 0U;
+            nibble = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? ((uint8_t)counter) : ((uint8_t)(counter << 4U));
+            api_crc_processBit(device, &reg, &nibble, 0, 4);
+            api_crc_writeTable(reg, table, counter);
+        }
+    }
+    else
+    {
+        for(counter = 0; counter <= 255; counter++)
+        {
+            reg = 0U;
+            api_crc_processBit(device, &reg, (uint8_t *)&counter, 0, 8);
+            api_crc_writeTable(reg, table, counter);
+        }
+    }
+
+    // The next table follows from the previous one by one more zero byte.
+    sizeofSlice /= sizeof(uint64_t);
+
+    for(slice = 1U; slice < api_crc_type2Slices(type); slice++)
+    {
+        for(counter = 0; counter <= 255; counter++)
+        {
+            reg = api_crc_readTable(&table[(slice - 1U) * sizeofSlice], counter);
+
+            if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+            {
+                reg = (reg >> 8U) ^ api_crc_readTable(table, reg & 0xFFU);
+            }
+            else
+            {
+                reg = (reg << 8U) ^ api_crc_readTable(table, reg >> ((sizeof(api_crc_register_t) - 1U) << 3U));
+            }
+
+            api_crc_writeTable(reg, &table[slice * sizeofSlice], counter);
+        }
+    }
+
+    if(type == API_CRC_TABLE_WORD)
+    {
+        api_crc_tableWord(device, table, sizeofSlice, api_crc_readTable, api_crc_writeTable);
+    }
+
+    device->table = table;
+    device->tableType = type;
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the size of the lookup table of the given layout.
+//!
+//! \details
+//! The size is the one of ::api_crc_sizeofTable multiplied by the number of
+//! tables of the layout (1 for ::API_CRC_TABLE_BYTE, 8 for ::API_CRC_TABLE_SLICING_BY_8
+//! and 16 for ::API_CRC_TABLE_SLICING_BY_16, 256 for ::API_CRC_TABLE_WORD) or divided by 16
+//! for ::API_CRC_TABLE_NIBBLE.
+//! For example, the table of half bytes for CRC-64 takes 128 bytes instead of 2048 bytes.
+//!
+//! \param[in] polynomial The Generator polynomial, which is taken from the initial data.
+//!
+//! \param[in] type ::api_crc_table_e Layout of the lookup table.
+//!
+//! \return size of the lookup table in bytes, 0 for an unknown layout.
+//!
+//! \par Example
+//! \code{.cpp}
+//! uint32_t size = 0U;
+//!
+//! // size = 8192;
+//! size = api_crc_sizeofTableOfType(0x82608EDB, API_CRC_TABLE_SLICING_BY_8);
+//! \endcode
+//!
+//------------------------------------------------------------------------------
+uint32_t api_crc_sizeofTableOfType(uint64_t const polynomial, api_crc_table_e const type)
+{
+    return api_crc_type2Size(api_crc_sizeofTable(polynomial), type);
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function computes the table of the bytes, which leave a window of a fixed
+//! length, for the rolling CRC ::api_crc_roll.
+//!
+//! \details
+//! The byte b, which leaves the window of W bytes, contributes its register shifted
+//! over the W bytes of the window, i.e. multiplied by \f$x^{8W} \bmod P\f$. The entry
+//! of b adds the shift of the initial value inputXOR over one more byte as well, so
+//! the register of the window always starts from inputXOR. The table has the layout
+//! and the width of the entries of the byte-wise table of ::api_crc_table.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[out] *table Pointer to the table of the leaving bytes.
+//!
+//! \param[in] size Size of the table in bytes (see ::api_crc_sizeofTable).
+//!
+//! \param[in] window The length of the window in bytes.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_rollTable"];
+//!
+//! CALLER=>FU[label = "api_crc_rollTable(device, table, size, window)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // the table of the bytes leaving a window of 64 bytes
+//! uint64_t table[256U];
+//! if (api_crc_rollTable(&device, table, api_crc_sizeofTable(polynomial), 64U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The device is initialized with ::api_crc_init.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_rollTable(api_crc_device_s const *const device, uint64_t *const table, uint16_t const size, uint32_t const window)
+{
+    api_crc_register_t (*api_crc_readTable)(uint64_t const *const, uint8_t const) = 0U;
+    void (*api_crc_writeTable)(api_crc_register_t const reg, uint64_t *const table, uint8_t const index) = 0U;
+    uint64_t polynomial = 0U;
+    uint64_t factor = 0U;
+    api_crc_register_t initial = 0U;
+    api_crc_register_t reg = 0U;
+    uint16_t counter = 0U;
+    uint8_t byte = 0U;
+
+    if((device == NULL) || (table == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    if(size != api_crc_order2Size((sizeof(device->polynomial) << 3U) - ((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial)))))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    api_crc_tableAccess(device, &api_crc_readTable, &api_crc_writeTable);
+    polynomial = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (api_crc_reverse64(device->polynomial)) : (device->polynomial);
+    factor = api_crc_xPowerModFast((uint64_t)window << 3U, polynomial);
+
+    // inputXOR + inputXOR * x^8, the initial value of the window one byte back
+    initial = device->inputXOR ^ api_crc_shiftRegister(device, device->inputXOR, 8U);
+
+    for(counter = 0U; counter <= 255U; counter++)
+    {
+        reg = 0U;
+        byte = (uint8_t)counter;
+
+        if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+        {
+            api_crc_processReverseBit(device, &reg, &byte, 0U, 8U);
+        }
+        else
+        {
+            api_crc_processForwardBit(device, &reg, &byte, 0U, 8U);
+        }
+
+        api_crc_writeTable(api_crc_multiplyRegister(device, reg ^ initial, factor), table, byte);
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method used to api_crc_reset cleaning of old data.
+//!
+//! \details
+//! The function resets the variable state to initial value, i.e. state = device.inputXOR
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
 //!
 //! \param[in,out] *state ::api_crc_state_t State register for storing intermediate as well as the final value of the
 //! Cyclic Redundancy Code (CRC) checksum calculation.
@@ -968,6 +2137,16 @@ api_crc_status_e api_crc_reset(api_crc_device_s const *const device, api_crc_sta
 //!
 //! \details
 //! Before starting calculations a decision on the algorithm (Directly LFSR or LUT)
+//! is made. The LUT process uses the layout of the table stored in the device
+//! (one byte per lookup or slicing-by-8 / slicing-by-16, see ::api_crc_tableOfType).
+//! In the build for performance, the byte-wise LUT process folds blocks of at least 64 bytes
+//! with the carry-less multiplication (PCLMULQDQ), if the CPU supports it, and looks
+//! up the remaining bytes in the table. Buffers of at least 4096 bytes are folded
+//! with VPCLMULQDQ (AVX-512), if the CPU supports it. A device of CRC-32C (Castagnoli, LSB) uses
+//! the instruction CRC32 (SSE4.2) instead, also without a table. Without these instructions, buffers of at least
+//! 3072 bytes are looked up in three interleaved lanes of the byte-wise table.
+//! In the build for code size, the Directly LFSR process reduces 64 bits per step with
+//! a software carry-less multiplication and the Barrett constants of the device, no table is needed.
 //!
 //! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
 //!
@@ -1134,9 +2313,26 @@ api_crc_status_e api_crc_reset(api_crc_device_s const *const device, api_crc_sta
 api_crc_status_e api_crc_process(api_crc_device_s const *const device, api_crc_state_t *const state, uint8_t const *const buffer, uint8_t const offset, uint32_t const size)
 {
     void (*api_crc_processBit)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint8_t const, uint32_t const) = 0U;
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+    void (*api_crc_processLUT)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint32_t const) = 0U;
+    void (*api_crc_processSlicing)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint32_t const) = 0U;
+    void (*api_crc_processWord)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint32_t const) = 0U;
+#else
     void (*api_crc_processLUT)(api_crc_device_s const *const, api_crc_register_t *const, api_crc_register_t (*)(uint64_t const *const, uint8_t const), uint8_t const *const, uint32_t const) = 0U;
     api_crc_register_t (*api_crc_readTable)(uint64_t const *const, uint8_t const) = 0U;
+#endif // OPTIMIZE
+#if (OPTIMIZE == BUILD_FOR_PERFORM) || (OPTIMIZE == BUILD_FOR_DATA)
+    void (*api_crc_processNibble)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint32_t const) = 0U;
+#endif // OPTIMIZE
+#ifdef API_CRC_CLMUL
+    uint32_t (*api_crc_processCLMUL)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint32_t const) = 0U;
+    uint32_t (*api_crc_processVPCLMUL)(api_crc_device_s const *const, api_crc_register_t *const, uint8_t const *const, uint32_t const) = 0U;
+#endif // API_CRC_CLMUL
     api_crc_register_t reg = 0U;
+    uint8_t const *data = NULL;
+    uint32_t bytes = 0U;
+    uint32_t folded = 0U;
+    uint8_t head = 0U;
     uint8_t order = 0U;
 
     if((device == NULL) || (state == NULL) || (buffer == NULL) || (offset >= 8U)
@@ -1144,6 +2340,11 @@ api_crc_status_e api_crc_process(api_crc_device_s const *const device, api_crc_s
     {
         return API_CRC_STATUS_INVALID_PARAMETER;
     }
+
+    if((device->table != NULL) && (!api_crc_isTableSupported(device->tableType)))
+    {
+        return API_CRC_STATUS_NOT_SUPPORTED;
+    }
 //    printf("check of parameters %llu and %llu\n", (unsigned long long) ((uint64_t)((uint64_t)buffer + ((uint64_t)size >> 3U))), (unsigned long long) (uint64_t) buffer);
 //    printf("check of parameters %llu\n", (unsigned long long) size);
 
@@ -1151,26 +2352,52 @@ api_crc_status_e api_crc_process(api_crc_device_s const *const device, api_crc_s
     {
 //        printf("processReverse\n");
         api_crc_processBit = api_crc_processReverseBit;
+#if (OPTIMIZE != BUILD_FOR_PERFORM)
         api_crc_processLUT = api_crc_processReverseLUT;
+#endif // OPTIMIZE
+#ifdef API_CRC_CLMUL
+        api_crc_processCLMUL = api_crc_processReverseCLMUL;
+        api_crc_processVPCLMUL = api_crc_processReverseVPCLMUL;
+#endif // API_CRC_CLMUL
         reg = (*state);
         order = (sizeof(device->polynomial) << 3U) - __builtin_clzll(device->polynomial);
 
         if(order <= 8U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processReverseLUT08;
+            api_crc_processSlicing = api_crc_processReverseSlicing08;
+#else
             api_crc_readTable = api_crc_readReverseTable08;
+#endif // OPTIMIZE
         }
         else if(order <= 16U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processReverseLUT16;
+            api_crc_processSlicing = api_crc_processReverseSlicing16;
+#else
             api_crc_readTable = api_crc_readReverseTable16;
+#endif // OPTIMIZE
         }
         else if(order <= 32U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processReverseLUT32;
+            api_crc_processSlicing = api_crc_processReverseSlicing32;
+#else
             api_crc_readTable = api_crc_readReverseTable32;
+#endif // OPTIMIZE
         }
 #ifdef PLATFORM_X86_64
         else if(order <= 64U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processReverseLUT64;
+            api_crc_processSlicing = api_crc_processReverseSlicing64;
+#else
             api_crc_readTable = api_crc_readReverseTable64;
+#endif // OPTIMIZE
         }
 #endif
         else
@@ -1183,26 +2410,52 @@ api_crc_status_e api_crc_process(api_crc_device_s const *const device, api_crc_s
     {
 //        printf("processForward\n");
         api_crc_processBit = api_crc_processForwardBit;
+#if (OPTIMIZE != BUILD_FOR_PERFORM)
         api_crc_processLUT = api_crc_processForwardLUT;
+#endif // OPTIMIZE
+#ifdef API_CRC_CLMUL
+        api_crc_processCLMUL = api_crc_processForwardCLMUL;
+        api_crc_processVPCLMUL = api_crc_processForwardVPCLMUL;
+#endif // API_CRC_CLMUL
         reg = (*state) >> ((sizeof(api_crc_state_t) - sizeof(api_crc_register_t)) << 3);
         order = (sizeof(device->polynomial) << 3U) - __builtin_ctzll(device->polynomial);
 
         if(order <= 8U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processForwardLUT08;
+            api_crc_processSlicing = api_crc_processForwardSlicing08;
+#else
             api_crc_readTable = api_crc_readForwardTable08;
+#endif // OPTIMIZE
         }
         else if(order <= 16U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processForwardLUT16;
+            api_crc_processSlicing = api_crc_processForwardSlicing16;
+#else
             api_crc_readTable = api_crc_readForwardTable16;
+#endif // OPTIMIZE
         }
         else if(order <= 32U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processForwardLUT32;
+            api_crc_processSlicing = api_crc_processForwardSlicing32;
+#else
             api_crc_readTable = api_crc_readForwardTable32;
+#endif // OPTIMIZE
         }
 #ifdef PLATFORM_X86_64
         else if(order <= 64U)
         {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT = api_crc_processForwardLUT64;
+            api_crc_processSlicing = api_crc_processForwardSlicing64;
+#else
             api_crc_readTable = api_crc_readForwardTable64;
+#endif // OPTIMIZE
         }
 #endif
         else
@@ -1212,184 +2465,1930 @@ api_crc_status_e api_crc_process(api_crc_device_s const *const device, api_crc_s
         }
     }
 
-    if(device->table == NULL)
+#ifdef API_CRC_CLMUL
+    // The instruction CRC32 needs no table, it replaces the byte-wise one.
+    if((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) && (device->polynomial == API_CRC_CRC32C_POLYNOMIAL)
+            && ((device->table == NULL) || (device->tableType == API_CRC_TABLE_BYTE)) && (api_crc_isEngineEnabled(API_CRC_ENGINE_CRC32C)))
     {
-        api_crc_processBit(device, &reg, buffer, offset, size);
+        head = (offset == 0U) ? (0U) : (((8U - offset) < size) ? (8U - offset) : (size));
+        bytes = (size - head) >> 3U;
+        data = (offset == 0U) ? (&buffer[0U]) : (&buffer[1U]);
+
+        api_crc_processBit(device, &reg, buffer, offset, head);
+        folded = api_crc_processCRC32C(device, &reg, data, bytes);
+        api_crc_processBit(device, &reg, &data[folded], 0U, size - head - (folded << 3U));
     }
     else
+#endif // API_CRC_CLMUL
+    if(device->table == NULL)
     {
-        api_crc_processBit(device, &reg, buffer, offset, (offset == 0U) ? (0U) : (((8U - offset) < size) ? (8U - offset) : (size)));
-        api_crc_processLUT(device, &reg, api_crc_readTable, (offset == 0U) ? (&buffer[0U]) : (&buffer[1U]), (size - ((offset == 0U) ? (0U) : (((8U - offset) < size) ? (8U - offset) : (size)))) >> 3U);
-        api_crc_processBit(device, &reg, &buffer[((uint64_t)offset + (uint64_t)size) >> 3U], 0U, ((((uint64_t)offset + (uint64_t)size) >> 3U) == 0U) ? (0U) : (((uint64_t)offset + (uint64_t)size) & 7U));
-    }
+#if (OPTIMIZE == BUILD_FOR_SIZE)
+        // the constants are missing in a device of the macro API_CRC_INIT
+        if(device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U)
+        {
+            head = (offset == 0U) ? (0U) : (((8U - offset) < size) ? (8U - offset) : (size));
+            bytes = (size - head) >> 3U;
+            data = (offset == 0U) ? (&buffer[0U]) : (&buffer[1U]);
 
-    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
-    {
-        (*state) = (api_crc_state_t)reg;
+            api_crc_processBit(device, &reg, buffer, offset, head);
+            folded = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+                     ? (api_crc_processReverseBarrett(device, &reg, data, bytes)) : (api_crc_processForwardBarrett(device, &reg, data, bytes));
+            api_crc_processBit(device, &reg, &data[folded], 0U, size - head - (folded << 3U));
+        }
+        else
+#endif // OPTIMIZE
+        {
+            api_crc_processBit(device, &reg, buffer, offset, size);
+        }
     }
     else
     {
-        (*state) = (api_crc_state_t)reg << ((sizeof(api_crc_state_t) - sizeof(api_crc_register_t)) << 3);
-    }
-
-    return API_CRC_STATUS_SUCCESS;
-}
-
+        // leading bits up to the byte boundary, whole bytes, trailing bits
+        head = (offset == 0U) ? (0U) : (((8U - offset) < size) ? (8U - offset) : (size));
+        bytes = (size - head) >> 3U;
+        data = (offset == 0U) ? (&buffer[0U]) : (&buffer[1U]);
 
-//------------------------------------------------------------------------------
-//!
-//! \brief
-//! This method returns the requested value and taking order predetermined values
-//! outputOrder, outputOrder and the value outputXOR.
-//!
-//! \details
-//! The function was, depending on which method (Direct or Reverse) processed,
-//! returns the correct value of the state variable (register).
+        api_crc_processBit(device, &reg, buffer, offset, head);
+#if (OPTIMIZE == BUILD_FOR_PERFORM) || (OPTIMIZE == BUILD_FOR_DATA)
+        api_crc_processNibble = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (api_crc_processReverseNibble) : (api_crc_processForwardNibble);
+#endif // OPTIMIZE
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+        api_crc_processWord = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT) ? (api_crc_processReverseWord) : (api_crc_processForwardWord);
+#endif // OPTIMIZE
+#ifdef API_CRC_CLMUL
+        // The instructions of the CPU replace the byte-wise table, the other
+        // layouts of the table are processed as requested.
+        if(device->tableType == API_CRC_TABLE_BYTE)
+        {
+            // the constants are missing in a device of the macro API_CRC_INIT
+            if((bytes >= API_CRC_VPCLMUL_MIN_SIZE) && (device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U) && (api_crc_isEngineEnabled(API_CRC_ENGINE_VPCLMUL)))
+            {
+                folded = api_crc_processVPCLMUL(device, &reg, data, bytes);
+            }
+            else if((bytes >= API_CRC_CLMUL_MIN_SIZE) && (device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U) && (api_crc_isEngineEnabled(API_CRC_ENGINE_CLMUL)))
+            {
+                folded = api_crc_processCLMUL(device, &reg, data, bytes);
+            }
+        }
+#endif // API_CRC_CLMUL
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+        if((device->tableType == API_CRC_TABLE_SLICING_BY_8) || (device->tableType == API_CRC_TABLE_SLICING_BY_16))
+        {
+            api_crc_processSlicing(device, &reg, &data[folded], bytes - folded);
+        }
+        else if(device->tableType == API_CRC_TABLE_WORD)
+        {
+            api_crc_processWord(device, &reg, &data[folded], bytes - folded);
+        }
+        else
+#endif // OPTIMIZE
+#if (OPTIMIZE == BUILD_FOR_PERFORM) || (OPTIMIZE == BUILD_FOR_DATA)
+        if(device->tableType == API_CRC_TABLE_NIBBLE)
+        {
+            api_crc_processNibble(device, &reg, &data[folded], bytes - folded);
+        }
+        else
+#endif // OPTIMIZE
+        {
+#if (OPTIMIZE == BUILD_FOR_PERFORM)
+            api_crc_processLUT(device, &reg, &data[folded], bytes - folded);
+#else
+            api_crc_processLUT(device, &reg, api_crc_readTable, &data[folded], bytes - folded);
+#endif // OPTIMIZE
+        }
+        api_crc_processBit(device, &reg, &data[bytes], 0U, (size - head) & 7U);
+    }
+
+    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    {
+        (*state) = (api_crc_state_t)reg;
+    }
+    else
+    {
+        (*state) = (api_crc_state_t)reg << ((sizeof(api_crc_state_t) - sizeof(api_crc_register_t)) << 3);
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method advances the CRC proof sum over a run of zero bits without
+//! processing them.
+//!
+//! \details
+//! The state register is multiplied by \f$x^{size} \bmod P\f$, the power is computed
+//! by squaring and multiplying in at most 64 steps. A region known to be zero,
+//! e.g. of a disk image, is skipped without being read or materialised.
 //!
 //! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
 //!
 //! \param[in,out] *state ::api_crc_state_t State register for storing intermediate as well as the final value of the
 //! Cyclic Redundancy Code (CRC) checksum calculation.
 //!
-//! \retval ::API_CRC_STATUS_SUCCESS Exclusive access has been granted.
-//! \retval ::API_CRC_STATUS_INVALID_PARAMETER Provided parameter(s) are invalid.
-//! \retval ::API_CRC_STATUS_NOT_SUPPORTED Function call is not supported.
+//! \param[in] size The number of zero bits.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
 //!
 //! \par Message Sequence Chart
 //!
 //! \msc
 //! hscale = "1", arcgradient = "8";
 //!
-//! CALLER[label = "Caller"], FU[label = "api_crc_finalize"];
-//!
-//! CALLER=>FU[label = "api_crc_finalize(&device, &state)"];
-//!
-//! FU=>FU[label = "(device == NULL) || (state == NULL)"];
+//! CALLER[label = "Caller"], FU[label = "api_crc_processZeros"];
 //!
-//! FU>>CALLER[label = "API_CRC_STATUS_INVALID_PARAMETER", linecolor = "red"];
+//! CALLER=>FU[label = "api_crc_processZeros(device, state, size)"];
 //!
-//! FU>>CALLER[label = "API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
 //! \endmsc
 //!
 //! \par Example
-//! For example, let's LUT process CRC32 with the generator polynomial
-//! the generator polynomial CRC32 \f$G(x)=x^{32}+x^{26}+x^{23}+x^{22}+x^{16}+x^{12}+x^{11}+x^{10}+x^{8}+x^{7}+x^{5}+x^{4}+x^{2}+x+1\f$,
-//! - <tt>polynomial = 0x82608EDB;</tt>
-//! - <tt>inputXOR = 0x00000000;</tt>
-//! - <tt>outputXOR = 0x00000000;</tt>
-//! - Bits Order: MSB
-//! - <tt>inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;</tt>
-//! - <tt>outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;</tt>
-//! - for Directly LFSR process has to <tt>table = 0</tt>
-//! - <tt>buffer[] = {  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39 };</tt>
-//! - CRC-Rest = 0x24a56cf5;
-//! \.
 //! \code{.cpp}
-//! api_crc_device_s device;
-//! api_crc_state_t state = 0UL;
-//! uint8_t buffer = {
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
-//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39
-//! };
-//! uint32_t buffer_size = sizeof(buffer) << 3;
-//! uint8_t offset = 0U;
-//! uint16_t table_size = api_crc_sizeofTable(polynomial);
-//! uint32_t table32[256];
-//!
-//! if (api_crc_table(&device, (uint64_t*) table32, table_size) != API_CRC_STATUS_SUCCESS)
+//! // header, 100 GB of zeros and trailer
+//! api_crc_reset(&device, &state);
+//! api_crc_process(&device, &state, header, 0U, sizeof(header) << 3);
+//! if (api_crc_processZeros(&device, &state, 100000000000ULL << 3) != API_CRC_STATUS_SUCCESS)
 //! {
 //!    // Error handling...
 //!    return 1;
 //! }
+//! api_crc_process(&device, &state, trailer, 0U, sizeof(trailer) << 3);
+//! api_crc_finalize(&device, &state);
+//! \endcode
 //!
-//! // LUT process
-//! if (api_crc_init(polynomial, inputXOR, outputXOR, table32, inputOrder, outputOrder, &device) != API_CRC_STATUS_SUCCESS)
-//! {
-//!    // Error handling...
-//!    return 1;
-//! }
+//! \pre
+//! The functions ::api_crc_init and ::api_crc_reset are called before.
 //!
-//! // (state = device.inputXOR)
-//! if (api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS)
-//! {
-//!    // Error handling...
-//!    return 1;
-//! }
+//! \post
+//! After expiration, the function should be called ::api_crc_finalize to get the correct CRC values.
 //!
-//! if (api_crc_process(&device, &state, buffer, offset, buffer_size) != API_CRC_STATUS_SUCCESS)
-//! {
-//!    // Error handling...
-//!    return 1;
-//! }
+//! \note
+//! Nothing.
 //!
-//! // before the start of api_crc_finalize was state = 0x24a56cf500000000
-//! if (api_crc_status_e api_crc_finalize(&device, &state) != API_CRC_STATUS_SUCCESS)
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processZeros(api_crc_device_s const *const device, api_crc_state_t *const state, uint64_t const size)
+{
+    if((device == NULL) || (state == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*state) = api_crc_shiftRegister(device, (*state), size);
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method advances the CRC proof sum over a run of copies of one byte
+//! without processing them.
+//!
+//! \details
+//! With the remainder m of one byte from a zero register and \f$y = x^8\f$, a run
+//! of k bytes adds \f$m (y^{k-1} + \ldots + y + 1)\f$ to the register multiplied by
+//! \f$y^k\f$. Both are built from the most significant bit of the count by doubling
+//! the run, \f$R_{2k} = R_k y^k + R_k\f$, and appending one byte, \f$R_{k+1} = R_k y + m\f$,
+//! so the cost grows with \f$\log_2 k\f$ only.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t State register for storing intermediate as well as the final value of the
+//! Cyclic Redundancy Code (CRC) checksum calculation.
+//!
+//! \param[in] value The repeated byte.
+//!
+//! \param[in] count The number of the bytes.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processConstant"];
+//!
+//! CALLER=>FU[label = "api_crc_processConstant(device, state, value, count)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC32 of one million 'a' = 0xdc25bfbc
+//! api_crc_reset(&device, &state);
+//! if (api_crc_processConstant(&device, &state, 'a', 1000000U) != API_CRC_STATUS_SUCCESS)
 //! {
 //!    // Error handling...
 //!    return 1;
 //! }
-//! // after the start of api_crc_finalize was state = 0x24a56cf5
-//! ...
+//! api_crc_finalize(&device, &state);
 //! \endcode
 //!
 //! \pre
-//! The method also needs the valid values for its arguments for a correct call.
-//! Therefore, the functions should be called ::api_crc_init, ::api_crc_reset and ::api_crc_process before.
+//! The functions ::api_crc_init and ::api_crc_reset are called before.
 //!
 //! \post
-//! Nothing.
+//! After expiration, the function should be called ::api_crc_finalize to get the correct CRC values.
 //!
 //! \note
-//! Nothing.
+//! The run starts at the current bit position of the stream, it need not be aligned to a byte.
 //!
 //! \warning
 //! Nothing.
 //!
 //------------------------------------------------------------------------------
-api_crc_status_e api_crc_finalize(api_crc_device_s const *const device, api_crc_state_t *const state)
+api_crc_status_e api_crc_processConstant(api_crc_device_s const *const device, api_crc_state_t *const state, uint8_t const value, uint64_t const count)
 {
-    uint8_t order = 0U;
+    uint8_t reverse = 0U;
+    uint64_t polynomial = 0U;
+    uint64_t remainder = 0U;
+    uint64_t power = 1U;
+    uint64_t run = 0U;
+    uint8_t counter = 0U;
 
     if((device == NULL) || (state == NULL))
     {
         return API_CRC_STATUS_INVALID_PARAMETER;
     }
 
-    (*state) ^= device->outputXOR;
+    reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    polynomial = (reverse) ? (api_crc_reverse64(device->polynomial)) : (device->polynomial);
+    // remainder of one byte from a zero register, in the normal order of the bits
+    remainder = api_crc_multiplyMod((reverse) ? (api_crc_reverse64(value)) : ((uint64_t)value << 56U), 1U << 8U, polynomial);
 
-    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    for(counter = (count == 0U) ? (0U) : (64U - __builtin_clzll(count)); counter > 0U; counter--)
     {
-        if(device->outputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
-        {
-            order = 0U;
-        }
-        else
+        run = api_crc_multiplyMod(run, power, polynomial) ^ run;
+        power = api_crc_multiplyMod(power, power, polynomial);
+
+        if(((count >> (counter - 1U)) & 1U) != 0U)
         {
-            (*state) = api_crc_reverse64(*state);
-            order = __builtin_ctzll(device->polynomial);
+            run = api_crc_multiplyMod(run, 1U << 8U, polynomial) ^ remainder;
+            power = api_crc_multiplyMod(power, 1U << 8U, polynomial);
         }
     }
-    else
+
+    (*state) = api_crc_multiplyRegister(device, (*state), power) ^ ((reverse) ? (api_crc_reverse64(run)) : (run));
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method calculates the CRC proof sums of several devices in one pass
+//! over the buffer.
+//!
+//! \details
+//! The buffer is divided into blocks of 8 KB, each block is processed by
+//! ::api_crc_process for all devices in turn. A block is read from the memory
+//! once and stays in the L1 cache for the following devices, every device keeps
+//! its fastest process (table layout, PCLMULQDQ, CRC32). The devices may differ
+//! in all parameters, e.g. a CRC-16 of a header check and a CRC-32 of the payload.
+//!
+//! \param[in] **devices ::api_crc_device_s The array of count devices.
+//!
+//! \param[in,out] *states ::api_crc_state_t The array of count state registers, one for each device.
+//!
+//! \param[in] count The number of the devices, at least 1.
+//!
+//! \param[in] *buffer The data as for ::api_crc_process.
+//!
+//! \param[in] offset The offset of the first bit in the first byte of the buffer, 0 to 7.
+//!
+//! \param[in] size The number of bits.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processMulti"];
+//!
+//! CALLER=>FU[label = "api_crc_processMulti(devices, states, count, buffer, offset, size)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC-16 and CRC-32 of the same buffer
+//! api_crc_device_s const *devices[2U] = {&deviceCRC16, &deviceCRC32};
+//! api_crc_state_t states[2U];
+//! api_crc_reset(devices[0U], &states[0U]);
+//! api_crc_reset(devices[1U], &states[1U]);
+//! if (api_crc_processMulti(devices, states, 2U, buffer, 0U, sizeof(buffer) << 3U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! api_crc_finalize(devices[0U], &states[0U]);
+//! api_crc_finalize(devices[1U], &states[1U]);
+//! \endcode
+//!
+//! \pre
+//! The functions ::api_crc_init and ::api_crc_reset are called before for every device.
+//!
+//! \post
+//! After expiration, the function should be called ::api_crc_finalize to get the correct CRC values.
+//!
+//! \note
+//! All devices are checked before the first block, in the case of an error none
+//! of the states is changed.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processMulti(api_crc_device_s const *const *const devices, api_crc_state_t *const states, uint8_t const count,
+                                      uint8_t const *const buffer, uint8_t const offset, uint32_t const size)
+{
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t state = 0U;
+    uint64_t position = offset;
+    uint64_t const end = (uint64_t)offset + size;
+    uint64_t step = 0U;
+    uint8_t counter = 0U;
+
+    if((devices == NULL) || (states == NULL) || (count == 0U))
     {
-        if(device->outputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the checks of api_crc_process for the whole buffer, without processing a bit
+    for(counter = 0U; counter < count; counter++)
+    {
+        state = states[counter];
+        if((status = api_crc_process(devices[counter], &state, buffer, offset, 0U)) != API_CRC_STATUS_SUCCESS)
         {
-            (*state) = api_crc_reverse64(*state);
-            order = 0U;
+            return status;
         }
-        else
+    }
+
+    if(((uint64_t)((void *)((uint64_t)buffer + ((end + 7ULL) >> 3U)))) < (uint64_t)buffer)
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    while(position < end)
+    {
+        // up to the end of the block of the position
+        step = (((position >> 3U) / API_CRC_MULTI_BLOCK_SIZE) + 1U) * (API_CRC_MULTI_BLOCK_SIZE << 3U) - position;
+        step = (step < (end - position)) ? (step) : (end - position);
+
+        for(counter = 0U; counter < count; counter++)
         {
-            order = __builtin_ctzll(device->polynomial);
+            api_crc_process(devices[counter], &states[counter], &buffer[position >> 3U], (uint8_t)(position & 7U), (uint32_t)step);
         }
+
+        position += step;
     }
 
-    (*state) >>= order;
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method calculates the CRC proof sum of a large buffer in parallel threads.
+//!
+//! \details
+//! The buffer is split into segments of whole bytes, one for each thread, but not
+//! shorter than segment bytes. The first segment begins at the offset and the last
+//! ends at the last bit of the buffer. Each thread processes its segment by
+//! ::api_crc_process, the first from the state register and the others from a zero
+//! register. The registers are merged as by ::api_crc_combine: the register of the
+//! segments before is shifted over the bits of the next segment, i.e. multiplied by
+//! \f$x^{size} \bmod P\f$, and the register of the next segment is added. The result
+//! is bit-identical to ::api_crc_process for the whole buffer.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t The state register.
+//!
+//! \param[in] *buffer The data as for ::api_crc_process.
+//!
+//! \param[in] offset The offset of the first bit in the first byte of the buffer, 0 to 7.
+//!
+//! \param[in] size The number of bits.
+//!
+//! \param[in] threads The maximum number of the threads including the calling thread,
+//! 1 to ::API_CRC_PARALLEL_THREADS.
+//!
+//! \param[in] segment The minimum number of bytes of a segment, at least 1.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processParallel"];
+//!
+//! CALLER=>FU[label = "api_crc_processParallel(device, state, buffer, offset, size, threads, segment)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // 4 threads, segments of at least 1 MB
+//! api_crc_reset(&device, &state);
+//! if (api_crc_processParallel(&device, &state, image, 0U, sizeof(image) << 3U, 4U, 1U << 20U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! api_crc_finalize(&device, &state);
+//! \endcode
+//!
+//! \pre
+//! The functions ::api_crc_init and ::api_crc_reset are called before.
+//!
+//! \post
+//! After expiration, the function should be called ::api_crc_finalize to get the correct CRC value.
+//!
+//! \note
+//! A buffer shorter than two segments is processed in the calling thread. If a thread
+//! cannot be created, or without the POSIX threads of API_CRC_PTHREADS, its segment
+//! is processed in the calling thread as well.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processParallel(api_crc_device_s const *const device, api_crc_state_t *const state, uint8_t const *const buffer, uint8_t const offset,
+        uint32_t const size, uint8_t const threads, uint32_t const segment)
+{
+    api_crc_segment_s segments[API_CRC_PARALLEL_THREADS];
+#ifdef API_CRC_PTHREADS
+    pthread_t handles[API_CRC_PARALLEL_THREADS];
+    uint8_t started[API_CRC_PARALLEL_THREADS];
+#endif // API_CRC_PTHREADS
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t reg = 0U;
+    uint64_t const end = (uint64_t)offset + size;
+    uint64_t const bytes = (end + 7ULL) >> 3U;
+    uint64_t position = offset;
+    uint64_t next = 0U;
+    uint8_t count = 0U;
+    uint8_t counter = 0U;
+
+    if((state == NULL) || (threads == 0U) || (threads > API_CRC_PARALLEL_THREADS) || (segment == 0U))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the checks of api_crc_process for the whole buffer, without processing a bit
+    reg = (*state);
+    if((status = api_crc_process(device, &reg, buffer, offset, 0U)) != API_CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if(((uint64_t)((void *)((uint64_t)buffer + bytes))) < (uint64_t)buffer)
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    count = ((bytes / segment) < threads) ? ((uint8_t)(bytes / segment)) : (threads);
+
+    if(count <= 1U)
+    {
+        return api_crc_process(device, state, buffer, offset, size);
+    }
+
+    for(counter = 0U; counter < count; counter++)
+    {
+        next = ((counter + 1U) == count) ? (end) : (((bytes * (counter + 1U)) / count) << 3U);
+        segments[counter].device = device;
+        segments[counter].buffer = &buffer[position >> 3U];
+        segments[counter].state = (counter == 0U) ? (*state) : (0U);
+        segments[counter].size = (uint32_t)(next - position);
+        segments[counter].offset = (uint8_t)(position & 7U);
+        position = next;
+    }
+
+#ifdef API_CRC_PTHREADS
+    for(counter = 1U; counter < count; counter++)
+    {
+        started[counter] = (pthread_create(&handles[counter], NULL, api_crc_processSegment, &segments[counter]) == 0);
+    }
+#endif // API_CRC_PTHREADS
+
+    api_crc_processSegment(&segments[0U]);
+    reg = segments[0U].state;
+
+    for(counter = 1U; counter < count; counter++)
+    {
+#ifdef API_CRC_PTHREADS
+        if(started[counter] != 0U)
+        {
+            pthread_join(handles[counter], NULL);
+        }
+        else
+#endif // API_CRC_PTHREADS
+        {
+            api_crc_processSegment(&segments[counter]);
+        }
+
+        reg = api_crc_shiftRegister(device, reg, segments[counter].size) ^ segments[counter].state;
+    }
+
+    (*state) = reg;
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method calculates the CRC values of many short independent messages in
+//! one call.
+//!
+//! \details
+//! The arguments and the device are checked once for the batch, instead of once
+//! for each of ::api_crc_reset, ::api_crc_process and ::api_crc_finalize of every
+//! message. With a byte-wise or a slicing table of the device, groups of 8 short
+//! messages are processed interleaved in 8 lanes by the byte table, i.e. 8
+//! independent chains of lookups, which the CPU overlaps, up to the end of the
+//! shortest message of the group; the rest of each message follows alone. The
+//! messages from 256 bytes on (a byte-wise table), from 64 bytes on (a byte-wise
+//! table replaced by the carry-less multiplication), from 32 bytes on (a slicing
+//! table), the empty messages and the last messages, which do not fill a group,
+//! are processed alone by ::api_crc_process.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in] **buffers The array of count messages.
+//!
+//! \param[in] *sizes The array of count sizes of the messages in bytes, each below 0x20000000.
+//!
+//! \param[out] *states ::api_crc_state_t The array of count CRC values, one for each message.
+//!
+//! \param[in] count The number of the messages.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processBatch"];
+//!
+//! CALLER=>FU[label = "api_crc_processBatch(device, buffers, sizes, states, count)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC values of the records of a telemetry frame
+//! uint8_t const *records[64U];
+//! uint32_t sizes[64U];
+//! api_crc_state_t crcs[64U];
+//! if (api_crc_processBatch(&device, records, sizes, crcs, 64U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_init is called before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The CRC values are final, ::api_crc_reset and ::api_crc_finalize are part of the
+//! batch. In the case of an error none of the CRC values is written.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processBatch(api_crc_device_s const *const device, uint8_t const *const *const buffers, uint32_t const *const sizes,
+                                      api_crc_state_t *const states, uint32_t const count)
+{
+    uint8_t const *data[API_CRC_BATCH_LANES];
+    uint32_t left[API_CRC_BATCH_LANES];
+    uint32_t message[API_CRC_BATCH_LANES];
+    api_crc_register_t reg[API_CRC_BATCH_LANES];
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t initial = 0U;
+    api_crc_state_t state = 0U;
+    uint32_t next = 0U;
+    uint32_t alone = 0U;
+    uint8_t const shift = (sizeof(api_crc_state_t) - sizeof(api_crc_register_t)) << 3U;
+    uint8_t reverse = 0U;
+    uint8_t width = 0U;
+    uint8_t interleaved = 0U;
+    uint8_t lane = 0U;
+
+    if((buffers == NULL) || (sizes == NULL) || (states == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the checks of api_crc_reset and api_crc_process for the device, without processing a bit
+    if(((status = api_crc_reset(device, &initial)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_process(device, &state, (uint8_t const *)sizes, 0U, 0U)) != API_CRC_STATUS_SUCCESS))
+    {
+        return status;
+    }
+
+    for(next = 0U; next < count; next++)
+    {
+        if((buffers[next] == NULL) || (sizes[next] > (UINT32_MAX >> 3U))
+                || (((uint64_t)((void *)((uint64_t)buffers[next] + sizes[next]))) < (uint64_t)buffers[next]))
+        {
+            return API_CRC_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    width = api_crc_order2Size((sizeof(device->polynomial) << 3U) - ((reverse) ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial)))) >> 8U;
+    interleaved = ((device->table != NULL) && ((device->tableType == API_CRC_TABLE_BYTE) || (device->tableType == API_CRC_TABLE_SLICING_BY_8)
+                   || (device->tableType == API_CRC_TABLE_SLICING_BY_16))) ? (1U) : (0U);
+    alone = (device->tableType == API_CRC_TABLE_BYTE) ? (API_CRC_BATCH_LONG_SIZE) : (API_CRC_BATCH_SLICING_SIZE);
+#ifdef API_CRC_CLMUL
+    // the instructions of the CPU, which replace the byte-wise table in api_crc_process, are faster than the lanes
+    if(device->tableType == API_CRC_TABLE_BYTE)
+    {
+        if((reverse) && (device->polynomial == API_CRC_CRC32C_POLYNOMIAL) && (api_crc_isEngineEnabled(API_CRC_ENGINE_CRC32C)))
+        {
+            interleaved = 0U;
+        }
+        else if((device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U) && (api_crc_isEngineEnabled(API_CRC_ENGINE_CLMUL)))
+        {
+            alone = API_CRC_CLMUL_MIN_SIZE;
+        }
+    }
+#endif // API_CRC_CLMUL
+
+    // a group of messages fills the lanes, the others are processed at once
+    for(next = 0U; next < count; next++)
+    {
+        if((interleaved == 0U) || (sizes[next] == 0U) || (sizes[next] >= alone))
+        {
+            state = initial;
+            api_crc_process(device, &state, buffers[next], 0U, sizes[next] << 3U);
+            api_crc_finalize(device, &state);
+            states[next] = state;
+        }
+        else
+        {
+            message[lane] = next;
+            data[lane] = buffers[next];
+            left[lane] = sizes[next];
+            reg[lane] = (reverse) ? ((api_crc_register_t)initial) : ((api_crc_register_t)(initial >> shift));
+
+            if(++lane == API_CRC_BATCH_LANES)
+            {
+                api_crc_processLanes(device->table, reg, data, left, width, reverse);
+
+                for(lane = 0U; lane < API_CRC_BATCH_LANES; lane++)
+                {
+                    state = (reverse) ? ((api_crc_state_t)reg[lane]) : ((api_crc_state_t)reg[lane] << shift);
+                    api_crc_finalize(device, &state);
+                    states[message[lane]] = state;
+                }
+
+                lane = 0U;
+            }
+        }
+    }
+
+    // the last group, which does not fill all lanes
+    while(lane > 0U)
+    {
+        lane--;
+        state = initial;
+        api_crc_process(device, &state, data[lane], 0U, left[lane] << 3U);
+        api_crc_finalize(device, &state);
+        states[message[lane]] = state;
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method calculates the CRC values of many independent messages of a few
+//! bits in one call.
+//!
+//! \details
+//! The messages of up to 128 bits are processed bit-sliced in groups of 64: the
+//! bits of the messages are transposed into words of one input bit of all 64
+//! messages, and the registers into the words of one register bit of all 64
+//! messages (bit-planes). Each input bit of the group then costs one word XOR for
+//! each term of the generator polynomial, for all 64 messages at once, instead of
+//! a step of the bit-serial processing of each message. The messages are aligned
+//! to a common end and processed from the zero register, the initial value is
+//! added after the message with its shift over the length of the message. The
+//! longer messages and a last group of less than 16 messages are processed alone
+//! by ::api_crc_process. The device needs no table, the arguments are checked once
+//! for the batch.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in] **buffers The array of count messages, each from the bit 0 of its first byte.
+//!
+//! \param[in] *sizes The array of count sizes of the messages in bits.
+//!
+//! \param[out] *states ::api_crc_state_t The array of count CRC values, one for each message.
+//!
+//! \param[in] count The number of the messages.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processBatchBits"];
+//!
+//! CALLER=>FU[label = "api_crc_processBatchBits(device, buffers, sizes, states, count)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC-5 values of 256 identifiers of 11 bits
+//! uint8_t const *identifiers[256U];
+//! uint32_t sizes[256U];
+//! api_crc_state_t crcs[256U];
+//! if (api_crc_processBatchBits(&device, identifiers, sizes, crcs, 256U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_init is called before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The CRC values are final, ::api_crc_reset and ::api_crc_finalize are part of the
+//! batch. In the case of an error none of the CRC values is written.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processBatchBits(api_crc_device_s const *const device, uint8_t const *const *const buffers, uint32_t const *const sizes,
+                                          api_crc_state_t *const states, uint32_t const count)
+{
+    uint8_t const *data[API_CRC_SLICED_LANES];
+    uint32_t bits[API_CRC_SLICED_LANES];
+    uint32_t message[API_CRC_SLICED_LANES];
+    uint64_t reg[API_CRC_SLICED_LANES];
+    uint64_t shifted[API_CRC_SLICED_MAX_SIZE + 1U];
+    uint64_t polynomial = 0U;
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t initial = 0U;
+    api_crc_state_t state = 0U;
+    uint32_t next = 0U;
+    uint8_t reverse = 0U;
+    uint8_t lane = 0U;
+
+    if((buffers == NULL) || (sizes == NULL) || (states == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the checks of api_crc_reset and api_crc_process for the device, without processing a bit
+    if(((status = api_crc_reset(device, &initial)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_process(device, &state, (uint8_t const *)sizes, 0U, 0U)) != API_CRC_STATUS_SUCCESS))
+    {
+        return status;
+    }
+
+    for(next = 0U; next < count; next++)
+    {
+        if((buffers[next] == NULL)
+                || (((uint64_t)((void *)((uint64_t)buffers[next] + ((sizes[next] + 7ULL) >> 3U)))) < (uint64_t)buffers[next]))
+        {
+            return API_CRC_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    // the initial value shifted over the bits of a message, bit by bit
+    reverse = (device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    polynomial = device->polynomial;
+    shifted[0U] = initial;
+
+    for(next = 1U; next <= API_CRC_SLICED_MAX_SIZE; next++)
+    {
+        shifted[next] = (reverse) ? ((shifted[next - 1U] >> 1U) ^ (((shifted[next - 1U] & 1U) != 0U) ? (polynomial) : (0U)))
+                        : ((shifted[next - 1U] << 1U) ^ (((shifted[next - 1U] >> 63U) != 0U) ? (polynomial) : (0U)));
+    }
+
+    // a group of messages fills the lanes, the longer messages are processed at once
+    for(next = 0U; next < count; next++)
+    {
+        if(sizes[next] > API_CRC_SLICED_MAX_SIZE)
+        {
+            state = initial;
+            api_crc_process(device, &state, buffers[next], 0U, sizes[next]);
+            api_crc_finalize(device, &state);
+            states[next] = state;
+        }
+        else
+        {
+            message[lane] = next;
+            data[lane] = buffers[next];
+            bits[lane] = sizes[next];
+            lane++;
+        }
+
+        if((lane == API_CRC_SLICED_LANES) || ((lane >= API_CRC_SLICED_MIN_LANES) && ((next + 1U) == count)))
+        {
+            api_crc_processSliced(device, data, bits, lane, reg);
+
+            while(lane > 0U)
+            {
+                lane--;
+                state = reg[lane] ^ shifted[bits[lane]];
+                api_crc_finalize(device, &state);
+                states[message[lane]] = state;
+            }
+        }
+    }
+
+    // the last group, which is too small for the bit-slicing
+    while(lane > 0U)
+    {
+        lane--;
+        state = initial;
+        api_crc_process(device, &state, data[lane], 0U, bits[lane]);
+        api_crc_finalize(device, &state);
+        states[message[lane]] = state;
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+#ifdef API_CRC_IOVEC
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method calculates the CRC proof sum over the segments of an I/O vector,
+//! e.g. the chain of the buffers of a packet, without gathering them into one
+//! buffer.
+//!
+//! \details
+//! The segments are processed in their order as one contiguous data, the register
+//! of the state goes on from one segment to the next one. The arguments are
+//! checked once for the vector. With the carry-less multiplication of the CPU the
+//! four folding lanes stay in the registers over all segments, and only the
+//! blocks over a boundary are gathered, the reduction is done once at the end.
+//! Otherwise, and for a segment long enough for the wide instructions, the
+//! whole blocks of 64 bytes of a segment are
+//! processed in place, the bytes of the rest of a segment, which do not fill a
+//! block, are copied together with the first bytes of the next segments into one
+//! block. So the carry-less multiplication and the slicing tables process only
+//! whole blocks up to the end of the last segment, and not a short rest byte by
+//! byte at each boundary of the segments. At most 63 bytes are copied for each
+//! boundary.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t Current state of the CRC calculation.
+//!
+//! \param[in] *vector The array of count segments, each of iov_len bytes at iov_base.
+//!
+//! \param[in] count The number of the segments.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processv"];
+//!
+//! CALLER=>FU[label = "api_crc_processv(device, state, vector, count)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC of the header and of the payload of a packet in two buffers
+//! struct iovec vector[2U] = {{header, sizeof(header)}, {payload, length}};
+//! if (api_crc_processv(&device, &state, vector, 2U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_reset is called before.
+//!
+//! \post
+//! The function ::api_crc_finalize is called after.
+//!
+//! \note
+//! A segment of the size zero may have no buffer. In the case of an error the state
+//! is not changed.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processv(api_crc_device_s const *const device, api_crc_state_t *const state, struct iovec const *const vector, uint32_t const count)
+{
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    uint32_t segment = 0U;
+
+    if(vector == NULL)
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the checks of api_crc_process for the device and the state, without processing a bit
+    if((status = api_crc_process(device, state, (uint8_t const *)vector, 0U, 0U)) != API_CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    for(segment = 0U; segment < count; segment++)
+    {
+        if(((vector[segment].iov_base == NULL) && (vector[segment].iov_len != 0U))
+                || (((uint64_t)vector[segment].iov_base + vector[segment].iov_len) < (uint64_t)vector[segment].iov_base))
+        {
+            return API_CRC_STATUS_INVALID_PARAMETER;
+        }
+    }
+
+    return api_crc_processSegments(device, state, vector, NULL, 0U, 0U, count);
+}
+#endif // API_CRC_IOVEC
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The method calculates the CRC proof sum over the rows of a two-dimensional
+//! buffer, e.g. the visible pixels of an image or a frame buffer, whose rows lie
+//! at a larger distance (pitch) than their size.
+//!
+//! \details
+//! The rows of size bytes at buffer, buffer + pitch, buffer + 2 * pitch, ... are
+//! processed in their order as one contiguous data, without copying the frame
+//! and without a call of ::api_crc_process for each row. The arguments are checked
+//! once for the whole buffer. With the carry-less multiplication of the CPU the
+//! four folding lanes stay in the registers over all rows, and only the blocks
+//! of 64 bytes over the end of a row are gathered. Otherwise, and for rows long
+//! enough for the wide instructions, the whole blocks of a row are processed in
+//! place and at most 63 bytes are copied for each end of a row, as in
+//! ::api_crc_processv. Rows without a gap (the pitch equal to the size) are
+//! processed as one buffer.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t Current state of the CRC calculation.
+//!
+//! \param[in] *buffer Pointer to the first byte of the first row.
+//!
+//! \param[in] size The number of bytes of a row.
+//!
+//! \param[in] pitch The distance in bytes from the beginning of a row to the beginning of the next row.
+//!
+//! \param[in] rows The number of the rows.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_processStrided"];
+//!
+//! CALLER=>FU[label = "api_crc_processStrided(device, state, buffer, size, pitch, rows)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC of the visible 1920 x 1080 pixels of 4 bytes in a frame buffer with a pitch of 8192 bytes
+//! if (api_crc_processStrided(&device, &state, frame, 1920U * 4U, 8192U, 1080U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_reset is called before.
+//!
+//! \post
+//! The function ::api_crc_finalize is called after.
+//!
+//! \note
+//! The pitch may be smaller than the size, then the rows overlap and the common
+//! bytes are processed once for each row. In the case of an error the state is not
+//! changed.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_processStrided(api_crc_device_s const *const device, api_crc_state_t *const state, uint8_t const *const buffer, uint32_t const size,
+                                        uint32_t const pitch, uint32_t const rows)
+{
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+
+    // the checks of api_crc_process for the device, the state and the buffer, without processing a bit
+    if((status = api_crc_process(device, state, buffer, 0U, 0U)) != API_CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if((rows != 0U) && (((uint64_t)buffer + ((uint64_t)(rows - 1U) * pitch) + size) < (uint64_t)buffer))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // rows without a gap are one buffer
+    if((pitch == size) && (rows != 0U))
+    {
+        return api_crc_processSegments(device, state, NULL, buffer, (uint64_t)size * rows, 0U, 1U);
+    }
+
+    return api_crc_processSegments(device, state, NULL, buffer, size, pitch, rows);
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This method moves the window of the rolling CRC by one byte.
+//!
+//! \details
+//! The entering byte is processed as by ::api_crc_process and the leaving byte is
+//! removed by the table of ::api_crc_rollTable. The register of the window is thus
+//! updated in a constant time, with two table lookups for a device with a byte-wise
+//! or a slicing table. The CRC value of the window follows from a copy of the state
+//! by ::api_crc_finalize.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in] *table The table of the leaving bytes from ::api_crc_rollTable.
+//!
+//! \param[in,out] *state ::api_crc_state_t The register of the window.
+//!
+//! \param[in] byteOut The byte, which leaves the window.
+//!
+//! \param[in] byteIn The byte, which enters the window.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_roll"];
+//!
+//! CALLER=>FU[label = "api_crc_roll(device, table, state, byteOut, byteIn)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // the CRC values of all windows of 64 bytes of the buffer
+//! api_crc_reset(&device, &state);
+//! api_crc_process(&device, &state, buffer, 0U, 64U << 3U);
+//! for (i = 64U; i < sizeof(buffer); i++)
+//! {
+//!     api_crc_roll(&device, table, &state, buffer[i - 64U], buffer[i]);
+//!     crc = state;
+//!     api_crc_finalize(&device, &crc);
+//! }
+//! \endcode
+//!
+//! \pre
+//! The table is computed by ::api_crc_rollTable for the device and the length of the window.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_roll(api_crc_device_s const *const device, uint64_t const *const table, api_crc_state_t *const state, uint8_t const byteOut, uint8_t const byteIn)
+{
+    api_crc_register_t (*api_crc_readTable)(uint64_t const *const, uint8_t const) = 0U;
+    void (*api_crc_writeTable)(api_crc_register_t const reg, uint64_t *const table, uint8_t const index) = 0U;
+
+    if((device == NULL) || (table == NULL) || (state == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    api_crc_tableAccess(device, &api_crc_readTable, &api_crc_writeTable);
+
+    // the byte-wise table is the first one of the slicing tables
+    if((device->table != NULL) && ((device->tableType == API_CRC_TABLE_BYTE) || (device->tableType == API_CRC_TABLE_SLICING_BY_8)
+                                   || (device->tableType == API_CRC_TABLE_SLICING_BY_16)))
+    {
+        if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+        {
+            (*state) = ((*state) >> 8U) ^ api_crc_readTable(device->table, ((*state) & 0xFFU) ^ byteIn);
+        }
+        else
+        {
+            (*state) = ((*state) << 8U) ^ api_crc_readTable(device->table, ((*state) >> ((sizeof(api_crc_register_t) - 1U) << 3U)) ^ byteIn);
+        }
+    }
+    else
+    {
+        api_crc_process(device, state, &byteIn, 0U, 8U);
+    }
+
+    (*state) ^= api_crc_readTable(table, byteOut);
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This method returns the requested value and taking order predetermined values
+//! outputOrder, outputOrder and the value outputXOR.
+//!
+//! \details
+//! The function was, depending on which method (Direct or Reverse) processed,
+//! returns the correct value of the state variable (register).
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t State register for storing intermediate as well as the final value of the
+//! Cyclic Redundancy Code (CRC) checksum calculation.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS Exclusive access has been granted.
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER Provided parameter(s) are invalid.
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED Function call is not supported.
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_finalize"];
+//!
+//! CALLER=>FU[label = "api_crc_finalize(&device, &state)"];
+//!
+//! FU=>FU[label = "(device == NULL) || (state == NULL)"];
+//!
+//! FU>>CALLER[label = "API_CRC_STATUS_INVALID_PARAMETER", linecolor = "red"];
+//!
+//! FU>>CALLER[label = "API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! \endmsc
+//!
+//! \par Example
+//! For example, let's LUT process CRC32 with the generator polynomial
+//! the generator polynomial CRC32 \f$G(x)=x^{32}+x^{26}+x^{23}+x^{22}+x^{16}+x^{12}+x^{11}+x^{10}+x^{8}+x^{7}+x^{5}+x^{4}+x^{2}+x+1\f$,
+//! - <tt>polynomial = 0x82608EDB;</tt>
+//! - <tt>inputXOR = 0x00000000;</tt>
+//! - <tt>outputXOR = 0x00000000;</tt>
+//! - Bits Order: MSB
+//! - <tt>inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;</tt>
+//! - <tt>outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;</tt>
+//! - for Directly LFSR process has to <tt>table = 0</tt>
+//! - <tt>buffer[] = {  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39 };</tt>
+//! - CRC-Rest = 0x24a56cf5;
+//! \.
+//! \code{.cpp}
+//! api_crc_device_s device;
+//! api_crc_state_t state = 0UL;
+//! uint8_t buffer = {
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+//!     0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39
+//! };
+//! uint32_t buffer_size = sizeof(buffer) << 3;
+//! uint8_t offset = 0U;
+//! uint16_t table_size = api_crc_sizeofTable(polynomial);
+//! uint32_t table32[256];
+//!
+//! if (api_crc_table(&device, (uint64_t*) table32, table_size) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//!
+//! // LUT process
+//! if (api_crc_init(polynomial, inputXOR, outputXOR, table32, inputOrder, outputOrder, &device) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//!
+//! // (state = device.inputXOR)
+//! if (api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//!
+//! if (api_crc_process(&device, &state, buffer, offset, buffer_size) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//!
+//! // before the start of api_crc_finalize was state = 0x24a56cf500000000
+//! if (api_crc_status_e api_crc_finalize(&device, &state) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! // after the start of api_crc_finalize was state = 0x24a56cf5
+//! ...
+//! \endcode
+//!
+//! \pre
+//! The method also needs the valid values for its arguments for a correct call.
+//! Therefore, the functions should be called ::api_crc_init, ::api_crc_reset and ::api_crc_process before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_finalize(api_crc_device_s const *const device, api_crc_state_t *const state)
+{
+    uint8_t order = 0U;
+
+    if((device == NULL) || (state == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*state) ^= device->outputXOR;
+
+    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    {
+        if(device->outputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+        {
+            order = 0U;
+        }
+        else
+        {
+            // the reflected polynomial has the term x^0 at the highest set bit
+            (*state) = api_crc_reverse64(*state);
+            order = __builtin_clzll(device->polynomial);
+        }
+    }
+    else
+    {
+        if(device->outputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+        {
+            (*state) = api_crc_reverse64(*state);
+            order = 0U;
+        }
+        else
+        {
+            order = __builtin_ctzll(device->polynomial);
+        }
+    }
+
+    (*state) >>= order;
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function combines the CRC values of two adjacent segments A and B to the
+//! CRC value of the concatenation A B, without processing the data again.
+//!
+//! \details
+//! The registers of both segments are restored from the final values. The register
+//! of A without its initial value is shifted over the length of B, i.e. multiplied
+//! by \f$x^{size} \bmod P\f$, and added to the register of B. The power is computed by
+//! squaring and multiplying, so the cost does not depend on the length of the segments.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *stateA ::api_crc_state_t Final CRC value of the segment A (see ::api_crc_finalize),
+//! the final CRC value of the concatenation A B on return.
+//!
+//! \param[in] stateB ::api_crc_state_t Final CRC value of the segment B.
+//!
+//! \param[in] size The length of the segment B in bits.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_combine"];
+//!
+//! CALLER=>FU[label = "api_crc_combine(device, stateA, stateB, size)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! api_crc_state_t stateA = 0U;
+//! api_crc_state_t stateB = 0U;
+//!
+//! // the first 301 bits and the remaining 499 bits of the buffer
+//! api_crc_reset(&device, &stateA);
+//! api_crc_process(&device, &stateA, buffer, 0U, 301U);
+//! api_crc_finalize(&device, &stateA);
+//! api_crc_reset(&device, &stateB);
+//! api_crc_process(&device, &stateB, &buffer[37], 5U, 499U);
+//! api_crc_finalize(&device, &stateB);
+//!
+//! // stateA = CRC value of all 800 bits
+//! if (api_crc_combine(&device, &stateA, stateB, 499U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Both CRC values are computed with the same device and finalized with ::api_crc_finalize.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_combine(api_crc_device_s const *const device, api_crc_state_t *const stateA, api_crc_state_t const stateB, uint64_t const size)
+{
+    if((device == NULL) || (stateA == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*stateA) = api_crc_shiftRegister(device, api_crc_restoreRegister(device, *stateA) ^ device->inputXOR, size) ^ api_crc_restoreRegister(device, stateB);
+    return api_crc_finalize(device, stateA);
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function removes the leading segment A from the CRC value of the
+//! concatenation A B and returns the CRC value of the segment B.
+//!
+//! \details
+//! It is the inverse of ::api_crc_combine for the segment B: the register of A
+//! without its initial value is shifted over the length of B, i.e. multiplied by
+//! \f$x^{size} \bmod P\f$, and subtracted from the register of A B. The cost does not
+//! depend on the length of the segments.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *stateAB ::api_crc_state_t Final CRC value of the concatenation A B
+//! (see ::api_crc_finalize), the final CRC value of the segment B on return.
+//!
+//! \param[in] stateA ::api_crc_state_t Final CRC value of the segment A.
+//!
+//! \param[in] size The length of the segment B in bits.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_removePrefix"];
+//!
+//! CALLER=>FU[label = "api_crc_removePrefix(device, stateAB, stateA, size)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // state = CRC value of all 800 bits, stateA = CRC value of the first 301 bits
+//! // state = CRC value of the remaining 499 bits
+//! if (api_crc_removePrefix(&device, &state, stateA, 499U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Both CRC values are computed with the same device and finalized with ::api_crc_finalize.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_removePrefix(api_crc_device_s const *const device, api_crc_state_t *const stateAB, api_crc_state_t const stateA, uint64_t const size)
+{
+    if((device == NULL) || (stateAB == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*stateAB) = api_crc_restoreRegister(device, *stateAB) ^ api_crc_shiftRegister(device, api_crc_restoreRegister(device, stateA) ^ device->inputXOR, size);
+    return api_crc_finalize(device, stateAB);
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function removes the trailing segment B from the CRC value of the
+//! concatenation A B and returns the CRC value of the segment A.
+//!
+//! \details
+//! It is the inverse of ::api_crc_combine for the segment A: the register of B is
+//! subtracted from the register of A B and the difference is shifted back over the
+//! length of B, i.e. multiplied by the inverse \f$x^{-size} \bmod P\f$. The inverse
+//! \f$x^{-1} = (P + 1) / x\f$ exists, since the generator polynomial P has the term
+//! \f$x^0\f$, and its power is computed by squaring and multiplying.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *stateAB ::api_crc_state_t Final CRC value of the concatenation A B
+//! (see ::api_crc_finalize), the final CRC value of the segment A on return.
+//!
+//! \param[in] stateB ::api_crc_state_t Final CRC value of the segment B.
+//!
+//! \param[in] size The length of the segment B in bits.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_removeSuffix"];
+//!
+//! CALLER=>FU[label = "api_crc_removeSuffix(device, stateAB, stateB, size)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // state = CRC value of all 800 bits, stateB = CRC value of the last 499 bits
+//! // state = CRC value of the first 301 bits
+//! if (api_crc_removeSuffix(&device, &state, stateB, 499U) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Both CRC values are computed with the same device and finalized with ::api_crc_finalize.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! ::api_crc_init always sets the term \f$x^0\f$ of the generator polynomial, a device
+//! without a polynomial (see ::API_CRC_INIT) has no inverse.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_removeSuffix(api_crc_device_s const *const device, api_crc_state_t *const stateAB, api_crc_state_t const stateB, uint64_t const size)
+{
+    if((device == NULL) || (stateAB == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    if(device->polynomial == 0U)
+    {
+        return API_CRC_STATUS_NOT_SUPPORTED;
+    }
+
+    (*stateAB) = api_crc_multiplyRegister(device, api_crc_restoreRegister(device, *stateAB) ^ api_crc_restoreRegister(device, stateB), api_crc_xInversePowerMod(device, size))
+                 ^ device->inputXOR;
+    return api_crc_finalize(device, stateAB);
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function derives the final CRC value of a device from the raw remainder
+//! of the data, i.e. the register processed from zero without the value inputXOR.
+//!
+//! \details
+//! The register of a device is the raw remainder plus its initial value shifted
+//! over the length of the data, i.e. multiplied by \f$x^{size} \bmod P\f$. One pass
+//! over the data thus serves all devices, which differ only in the values inputXOR,
+//! outputXOR or the output order, e.g. CRC-16/ARC, CRC-16/MAXIM and CRC-16/MODBUS.
+//! The cost does not depend on the length of the data.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t The raw remainder of the data, the final CRC value of
+//! the device on return.
+//!
+//! \param[in] size The length of the data in bits.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_derive"];
+//!
+//! CALLER=>FU[label = "api_crc_derive(device, state, size)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // the raw remainder of the data: the register starts from zero instead of api_crc_reset
+//! api_crc_state_t raw = 0U;
+//! api_crc_process(&deviceARC, &raw, buffer, 0U, sizeof(buffer) << 3U);
+//!
+//! api_crc_state_t stateMAXIM = raw;
+//! api_crc_state_t stateMODBUS = raw;
+//! if ((api_crc_derive(&deviceMAXIM, &stateMAXIM, sizeof(buffer) << 3U) != API_CRC_STATUS_SUCCESS)
+//!     || (api_crc_derive(&deviceMODBUS, &stateMODBUS, sizeof(buffer) << 3U) != API_CRC_STATUS_SUCCESS))
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The raw remainder is computed with a device of the same generator polynomial
+//! and the same input order.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Devices, which differ in the input order, process the bits of the data in a
+//! different order and do not share a raw remainder.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_derive(api_crc_device_s const *const device, api_crc_state_t *const state, uint64_t const size)
+{
+    if((device == NULL) || (state == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*state) ^= api_crc_shiftRegister(device, device->inputXOR, size);
+    return api_crc_finalize(device, state);
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function updates the final CRC value of a buffer after an in-place patch
+//! of some bytes, without processing the buffer again.
+//!
+//! \details
+//! The CRC is linear: the difference of the old and new bytes is processed from a
+//! zero register, shifted over the bytes after the patch with ::api_crc_processZeros
+//! and added to the CRC value in the order of the output. The cost grows with the
+//! size of the patch and the logarithm of the distance to the end of the buffer.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in,out] *state ::api_crc_state_t Final CRC value of the buffer before the patch
+//! (see ::api_crc_finalize), the final CRC value after the patch on return.
+//!
+//! \param[in] offset The position of the patch in the buffer in bytes.
+//!
+//! \param[in] *oldData The bytes before the patch.
+//!
+//! \param[in] *newData The bytes after the patch.
+//!
+//! \param[in] size The number of the patched bytes.
+//!
+//! \param[in] length The length of the whole buffer in bytes.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_patch"];
+//!
+//! CALLER=>FU[label = "api_crc_patch(device, state, offset, oldData, newData, size, length)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // a counter of 4 bytes at the position 10 of the buffer is incremented
+//! uint8_t counter[4];
+//! memcpy(counter, &buffer[10], sizeof(counter));
+//! buffer[13]++;
+//! if (api_crc_patch(&device, &state, 10U, counter, &buffer[10], sizeof(counter), sizeof(buffer)) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The CRC value is computed with the same device and finalized with ::api_crc_finalize.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The buffer starts at a byte boundary and consists of whole bytes.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_patch(api_crc_device_s const *const device, api_crc_state_t *const state, uint64_t const offset, uint8_t const *const oldData,
+                               uint8_t const *const newData, uint32_t const size, uint64_t const length)
+{
+    uint8_t difference[64U];
+    api_crc_state_t reg = 0U;
+    uint32_t counter = 0U;
+    uint32_t index = 0U;
+    uint32_t chunk = 0U;
+
+    if((device == NULL) || (state == NULL) || (oldData == NULL) || (newData == NULL) || (offset > length) || (size > (length - offset)))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the difference of the bytes from a zero register
+    for(counter = 0U; counter < size; counter += chunk)
+    {
+        chunk = ((size - counter) < sizeof(difference)) ? (size - counter) : (sizeof(difference));
+
+        for(index = 0U; index < chunk; index++)
+        {
+            difference[index] = oldData[counter + index] ^ newData[counter + index];
+        }
+
+        api_crc_process(device, &reg, difference, 0U, chunk << 3U);
+    }
+
+    api_crc_processZeros(device, &reg, (length - offset - size) << 3U);
+
+    // api_crc_finalize without the final value outputXOR
+    reg ^= device->outputXOR;
+    api_crc_finalize(device, &reg);
+    (*state) ^= reg;
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the engine of the CPU, which is used by ::api_crc_process.
+//!
+//! \details
+//! The engine is the best one, which is supported by the CPU and permitted by
+//! ::api_crc_setEngine. The CPU is queried once on first use, so a single build of
+//! the library serves every host. The engines permitted by the returned engine are
+//! used as well: the folding with VPCLMULQDQ falls back to PCLMULQDQ for buffers
+//! of less than 4096 bytes, the instruction CRC32 applies to CRC-32C devices only.
+//!
+//! \return the engine ::api_crc_engine_e, ::API_CRC_ENGINE_TABLE if the build or the
+//! CPU offers nothing beyond the lookup table.
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_getEngine"];
+//!
+//! CALLER=>FU[label = "api_crc_getEngine()"];
+//!
+//! FU>>CALLER[label = "return engine", linecolor = "#379B7A"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // e.g. API_CRC_ENGINE_VPCLMUL on a CPU with AVX-512 and without SSE4.2
+//! api_crc_engine_e engine = api_crc_getEngine();
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The table layouts other than ::API_CRC_TABLE_BYTE are processed as requested
+//! with every engine.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_engine_e api_crc_getEngine(void)
+{
+    api_crc_engine_e engine = API_CRC_ENGINE_CRC32C;
+
+    while((engine > API_CRC_ENGINE_TABLE) && (!api_crc_isEngineEnabled(engine)))
+    {
+        engine--;
+    }
+
+    return engine;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function selects the engine of the CPU for ::api_crc_process, e.g. to
+//! test or to compare the engines on the same host.
+//!
+//! \details
+//! The selected engine permits the engines listed before it in ::api_crc_engine_e,
+//! ::API_CRC_ENGINE_TABLE uses the lookup table only. ::API_CRC_ENGINE_AUTO restores
+//! the default, the best engine supported by the CPU.
+//!
+//! \param[in] engine ::api_crc_engine_e The engine to be used.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_setEngine"];
+//!
+//! CALLER=>FU[label = "api_crc_setEngine(engine)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // the byte-wise table without the carry-less multiplication
+//! if (api_crc_setEngine(API_CRC_ENGINE_TABLE) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! ...
+//! api_crc_setEngine(API_CRC_ENGINE_AUTO);
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! The selection applies to all devices of the process.
+//!
+//! \note
+//! An engine, which is not supported by the CPU or the build of the library,
+//! is rejected and the selection remains unchanged.
+//!
+//! \warning
+//! The selection is read and written atomically, it may be changed while another
+//! thread calls ::api_crc_process. A running call may then finish with the other
+//! engine, all engines compute the same CRC.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_setEngine(api_crc_engine_e const engine)
+{
+    if(engine > API_CRC_ENGINE_CRC32C)
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    if((engine != API_CRC_ENGINE_AUTO) && ((api_crc_supportedEngines() & (1U << engine)) == 0U))
+    {
+        return API_CRC_STATUS_NOT_SUPPORTED;
+    }
+
+    __atomic_store_n(&api_crc_engine, engine, __ATOMIC_RELAXED);
     return API_CRC_STATUS_SUCCESS;
 }
 
@@ -0,0 +1,432 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "../inc/api_crc_chunk.h"
+#include "../cfg/api_crc_cfg.h"
+#include "api_crc_private.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Enums
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Function Prototypes
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Data
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Public Data
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Functions
+//------------------------------------------------------------------------------
+
+// Window register rolled by one byte, the byte leaving the window is removed by the second lookup.
+static inline __attribute__((always_inline)) api_crc_register_t api_crc_chunkRollOf(uint64_t const *const in, uint64_t const *const out, api_crc_register_t const reg,
+        uint8_t const byteIn, uint8_t const byteOut, uint8_t const reverse)
+{
+    return api_crc_processByteOf(in, reg, byteIn, sizeof(api_crc_register_t), reverse) ^ out[byteOut];
+}
+
+// First chunk length in (begin, end] whose window register is zero in the bits of the mask, 0 if there is none.
+// The window register depends on the bytes of the window only, so four lanes of API_CRC_CHUNK_LANE_SIZE bytes
+// each load the window ahead of them and are rolled interleaved in independent registers. The first hit of
+// the lanes in their order is the first hit of the round.
+static inline __attribute__((always_inline)) uint32_t api_crc_chunkScanOf(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t begin,
+        uint32_t const end, api_crc_register_t const mask, uint8_t const reverse)
+{
+    uint64_t const *const in = chunker->in;
+    uint64_t const *const out = chunker->out;
+    uint8_t const *data = NULL;
+    uint8_t const *leave = NULL;
+    api_crc_register_t lane0, lane1, lane2, lane3;
+    uint32_t found0, found1, found2, found3;
+    uint32_t index = 0U;
+
+    while((end - begin) >= (API_CRC_CHUNK_LANE_SIZE << 2U))
+    {
+        data = &buffer[begin];
+        leave = &buffer[begin - chunker->window];
+        lane0 = lane1 = lane2 = lane3 = 0U;
+        found0 = found1 = found2 = found3 = 0U;
+
+        // the windows ahead of the lanes, a zero byte leaves nothing to remove
+        for(index = 0U; index < chunker->window; index++)
+        {
+            lane0 = api_crc_chunkRollOf(in, out, lane0, leave[index], 0U, reverse);
+            lane1 = api_crc_chunkRollOf(in, out, lane1, leave[index + API_CRC_CHUNK_LANE_SIZE], 0U, reverse);
+            lane2 = api_crc_chunkRollOf(in, out, lane2, leave[index + (API_CRC_CHUNK_LANE_SIZE << 1U)], 0U, reverse);
+            lane3 = api_crc_chunkRollOf(in, out, lane3, leave[index + (3U * API_CRC_CHUNK_LANE_SIZE)], 0U, reverse);
+        }
+
+        for(index = 0U; index < API_CRC_CHUNK_LANE_SIZE; index++)
+        {
+            lane0 = api_crc_chunkRollOf(in, out, lane0, data[index], leave[index], reverse);
+            lane1 = api_crc_chunkRollOf(in, out, lane1, data[index + API_CRC_CHUNK_LANE_SIZE], leave[index + API_CRC_CHUNK_LANE_SIZE], reverse);
+            lane2 = api_crc_chunkRollOf(in, out, lane2, data[index + (API_CRC_CHUNK_LANE_SIZE << 1U)], leave[index + (API_CRC_CHUNK_LANE_SIZE << 1U)], reverse);
+            lane3 = api_crc_chunkRollOf(in, out, lane3, data[index + (3U * API_CRC_CHUNK_LANE_SIZE)], leave[index + (3U * API_CRC_CHUNK_LANE_SIZE)], reverse);
+
+            // a hit is rare, the lanes are resolved only then
+            if(((lane0 & mask) == 0U) || ((lane1 & mask) == 0U) || ((lane2 & mask) == 0U) || ((lane3 & mask) == 0U))
+            {
+                found0 = ((found0 == 0U) && ((lane0 & mask) == 0U)) ? (begin + index + 1U) : (found0);
+                found1 = ((found1 == 0U) && ((lane1 & mask) == 0U)) ? (begin + index + 1U + API_CRC_CHUNK_LANE_SIZE) : (found1);
+                found2 = ((found2 == 0U) && ((lane2 & mask) == 0U)) ? (begin + index + 1U + (API_CRC_CHUNK_LANE_SIZE << 1U)) : (found2);
+                found3 = ((found3 == 0U) && ((lane3 & mask) == 0U)) ? (begin + index + 1U + (3U * API_CRC_CHUNK_LANE_SIZE)) : (found3);
+
+                // nothing precedes a hit of the first lane
+                if(found0 != 0U)
+                {
+                    return found0;
+                }
+            }
+        }
+
+        if((found1 | found2 | found3) != 0U)
+        {
+            return (found1 != 0U) ? (found1) : ((found2 != 0U) ? (found2) : (found3));
+        }
+
+        begin += API_CRC_CHUNK_LANE_SIZE << 2U;
+    }
+
+    data = &buffer[begin];
+    leave = &buffer[begin - chunker->window];
+    lane0 = 0U;
+
+    for(index = 0U; index < chunker->window; index++)
+    {
+        lane0 = api_crc_chunkRollOf(in, out, lane0, leave[index], 0U, reverse);
+    }
+
+    for(index = 0U; index < (end - begin); index++)
+    {
+        lane0 = api_crc_chunkRollOf(in, out, lane0, data[index], leave[index], reverse);
+
+        if((lane0 & mask) == 0U)
+        {
+            return begin + index + 1U;
+        }
+    }
+
+    return 0U;
+}
+
+static uint32_t api_crc_chunkScanForward(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t const begin, uint32_t const end, api_crc_register_t const mask)
+{
+    return api_crc_chunkScanOf(chunker, buffer, begin, end, mask, 0U);
+}
+
+static uint32_t api_crc_chunkScanReverse(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t const begin, uint32_t const end, api_crc_register_t const mask)
+{
+    return api_crc_chunkScanOf(chunker, buffer, begin, end, mask, 1U);
+}
+
+// First chunk length in (begin, end], 0 if there is none.
+static uint32_t api_crc_chunkScan(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t const begin, uint32_t const end, uint64_t const mask)
+{
+    if(begin >= end)
+    {
+        return 0U;
+    }
+
+    if(chunker->device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    {
+        return api_crc_chunkScanReverse(chunker, buffer, begin, end, (api_crc_register_t)mask);
+    }
+
+    return api_crc_chunkScanForward(chunker, buffer, begin, end, (api_crc_register_t)mask);
+}
+
+//------------------------------------------------------------------------------
+// Public Functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function prepares a chunker, which splits buffers at content-defined
+//! boundaries found by the CRC of the device over a rolling window of bytes.
+//!
+//! \details
+//! The register of the window is the CRC without the initial and final value over
+//! the last window bytes before a boundary. It is rolled by one byte with two lookups,
+//! one for the input byte and one for the byte leaving the window, the second table
+//! holds the register of a byte times \f$x^{8 \cdot window} \bmod P\f$. A boundary is
+//! placed where the register is zero in a mask of bits: with log2(average) + 1 bits
+//! for the chunks shorter than average and with log2(average) - 1 bits above, which
+//! keeps the sizes of the chunks close to average.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[in] minimum The minimum size of a chunk in bytes, greater than window.
+//!
+//! \param[in] average The average size of a chunk in bytes, at least minimum and 4,
+//! log2(average) + 1 must not exceed the order of the polynomial.
+//!
+//! \param[in] maximum The maximum size of a chunk in bytes, at least average and not
+//! above 0x1FFFFFFF, the size of a chunk in bits fits into ::api_crc_process.
+//!
+//! \param[in] window The size of the rolling window in bytes, at least 1.
+//!
+//! \param[out] *chunker ::api_crc_chunker_s The chunker for ::api_crc_chunk.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_chunkerInit"];
+//!
+//! CALLER=>FU[label = "api_crc_chunkerInit(device, minimum, average, maximum, window, chunker)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // chunks of 2 KB to 64 KB, 8 KB on average, window of 48 bytes
+//! api_crc_chunker_s chunker;
+//! api_crc_status_e status = api_crc_chunkerInit(&device, 2048U, 8192U, 65536U, 48U, &chunker);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_init is called before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The chunker keeps a pointer to the device, which must outlive the chunker.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_chunkerInit(api_crc_device_s const *const device, uint32_t const minimum, uint32_t const average, uint32_t const maximum,
+                                     uint32_t const window, api_crc_chunker_s *const chunker)
+{
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t state = 0U;
+    uint8_t byte = 0U;
+    uint8_t bits = 0U;
+    uint8_t order = 0U;
+    uint16_t index = 0U;
+
+    if((device == NULL) || (chunker == NULL) || (device->polynomial == 0U))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    order = (sizeof(device->polynomial) << 3U) - ((device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+            ? (__builtin_clzll(device->polynomial)) : (__builtin_ctzll(device->polynomial)));
+    bits = (average < 4U) ? (0U) : ((sizeof(average) << 3U) - 1U - __builtin_clz(average));
+
+    if((window == 0U) || (window >= minimum) || (minimum > average) || (average > maximum) || (maximum > (UINT32_MAX >> 3U))
+            || (bits < 2U) || ((bits + 1U) > order) || ((bits + 1U) > (sizeof(api_crc_register_t) << 3U)))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    chunker->device = device;
+    chunker->window = window;
+    chunker->minimum = minimum;
+    chunker->average = average;
+    chunker->maximum = maximum;
+    chunker->maskSmall = (1ULL << (bits + 1U)) - 1U;
+    chunker->maskLarge = (1ULL << (bits - 1U)) - 1U;
+
+    // the bits next to the input bits, the low bits of a reverse and the top bits of a forward register
+    if(device->inputOrder != API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    {
+        chunker->maskSmall <<= (sizeof(api_crc_register_t) << 3U) - (bits + 1U);
+        chunker->maskLarge <<= (sizeof(api_crc_register_t) << 3U) - (bits - 1U);
+    }
+
+    for(index = 0U; index < 256U; index++)
+    {
+        byte = (uint8_t)index;
+        state = 0U;
+        status = api_crc_process(device, &state, &byte, 0U, 8U);
+        chunker->in[index] = api_crc_stateRegister(device, state);
+
+        if(status == API_CRC_STATUS_SUCCESS)
+        {
+            status = api_crc_processZeros(device, &state, (uint64_t)window << 3U);
+        }
+
+        if(status != API_CRC_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        chunker->out[index] = api_crc_stateRegister(device, state);
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the first content-defined chunk of a buffer together
+//! with the CRC checksum of the chunk.
+//!
+//! \details
+//! The first minimum - window bytes are skipped, a boundary cannot be placed there.
+//! The window is rolled from the minimum up to the average size with the mask of
+//! the small chunks and up to the maximum size with the mask of the large chunks,
+//! without a boundary the chunk ends at the maximum size. The checksum of the chunk
+//! is calculated with ::api_crc_reset, ::api_crc_process and ::api_crc_finalize
+//! directly after the boundary, while the chunk is still in the caches.
+//!
+//! \param[in] *chunker ::api_crc_chunker_s The chunker of ::api_crc_chunkerInit.
+//!
+//! \param[in] *buffer The data, which begins with the chunk.
+//!
+//! \param[in] size The number of bytes of the buffer, at least 1.
+//!
+//! \param[out] *length The number of bytes of the chunk.
+//!
+//! \param[out] *state ::api_crc_state_t The CRC checksum of the chunk.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_chunk"];
+//!
+//! CALLER=>FU[label = "api_crc_chunk(chunker, buffer, size, length, state)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // all chunks of the buffer
+//! uint32_t length = 0U;
+//! while (size != 0U)
+//! {
+//!    if (api_crc_chunk(&chunker, buffer, size, &length, &state) != API_CRC_STATUS_SUCCESS)
+//!    {
+//!       // Error handling...
+//!       return 1;
+//!    }
+//!    // chunk of length bytes with the checksum state
+//!    buffer += length;
+//!    size -= length;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_chunkerInit is called before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! A buffer shorter than the maximum size without a boundary is returned as one
+//! chunk. For a stream, the buffer holds at least the maximum size of bytes unless
+//! it is the end of the stream.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_chunk(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t const size,
+                               uint32_t *const length, api_crc_state_t *const state)
+{
+    api_crc_device_s const *device = NULL;
+    uint32_t end = 0U;
+    uint32_t average = 0U;
+
+    if((chunker == NULL) || (buffer == NULL) || (size == 0U) || (length == NULL) || (state == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    device = chunker->device;
+    end = (size < chunker->maximum) ? (size) : (chunker->maximum);
+    average = (end < (chunker->average - 1U)) ? (end) : (chunker->average - 1U);
+
+    // the small mask up to average - 1 bytes, the large one from average bytes on
+    (*length) = api_crc_chunkScan(chunker, buffer, chunker->minimum - 1U, average, chunker->maskSmall);
+
+    if((*length) == 0U)
+    {
+        (*length) = api_crc_chunkScan(chunker, buffer, (chunker->average - 1U), end, chunker->maskLarge);
+    }
+
+    if((*length) == 0U)
+    {
+        (*length) = end;
+    }
+
+    api_crc_reset(device, state);
+    api_crc_process(device, state, buffer, 0U, (*length) << 3U);
+    return api_crc_finalize(device, state);
+}
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
@@ -0,0 +1,1176 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "../inc/api_crc_poly.h"
+#include "../cfg/api_crc_cfg.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Enums
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Types
+//------------------------------------------------------------------------------
+
+// Polynomial x^order + low over GF(2), low are the coefficients below x^order.
+typedef struct
+{
+    uint64_t low;
+    uint8_t order;
+} api_crc_poly_s;
+
+//------------------------------------------------------------------------------
+// Private Function Prototypes
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Data
+//------------------------------------------------------------------------------
+
+// Prime factors of 2^d - 1 for d = 1 to 64. The period of an irreducible polynomial
+// of the order d divides 2^d - 1.
+static uint64_t const api_crc_polyPrimes[] =
+{
+    3ULL, 5ULL, 7ULL, 11ULL, 13ULL,
+    17ULL, 19ULL, 23ULL, 29ULL, 31ULL,
+    37ULL, 41ULL, 43ULL, 47ULL, 53ULL,
+    59ULL, 61ULL, 71ULL, 73ULL, 79ULL,
+    89ULL, 97ULL, 103ULL, 109ULL, 113ULL,
+    127ULL, 151ULL, 157ULL, 223ULL, 233ULL,
+    241ULL, 251ULL, 257ULL, 331ULL, 337ULL,
+    397ULL, 431ULL, 601ULL, 631ULL, 641ULL,
+    673ULL, 683ULL, 881ULL, 1103ULL, 1321ULL,
+    1613ULL, 1801ULL, 2089ULL, 2113ULL, 2143ULL,
+    2351ULL, 2731ULL, 3191ULL, 4051ULL, 4513ULL,
+    5419ULL, 6361ULL, 8191ULL, 9719ULL, 11119ULL,
+    13367ULL, 23311ULL, 32377ULL, 43691ULL, 61681ULL,
+    65537ULL, 69431ULL, 87211ULL, 92737ULL, 121369ULL,
+    122921ULL, 131071ULL, 174763ULL, 178481ULL, 179951ULL,
+    201961ULL, 262657ULL, 524287ULL, 599479ULL, 649657ULL,
+    1212847ULL, 2099863ULL, 2796203ULL, 3033169ULL, 6700417ULL,
+    13264529ULL, 15790321ULL, 20394401ULL, 164511353ULL, 616318177ULL,
+    715827883ULL, 2147483647ULL, 3203431780337ULL, 4432676798593ULL, 2305843009213693951ULL
+};
+
+//------------------------------------------------------------------------------
+// Public Data
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Functions
+//------------------------------------------------------------------------------
+
+// Polynomial of the notation of api_crc_init: the leading bit is the term x^order,
+// the term x^0 is implied. The notation 0 is the polynomial 1.
+static api_crc_poly_s api_crc_polyOf(uint64_t const polynomial)
+{
+    api_crc_poly_s poly = {0U, 0U};
+
+    if(polynomial != 0U)
+    {
+        poly.order = (sizeof(polynomial) << 3U) - __builtin_clzll(polynomial);
+        poly.low = ((polynomial << 1U) | 1U) & (-1ULL >> ((sizeof(polynomial) << 3U) - poly.order));
+    }
+
+    return poly;
+}
+
+// Notation of api_crc_init of the polynomial.
+static uint64_t api_crc_polyNotation(api_crc_poly_s const poly)
+{
+    return (poly.order == 0U) ? (0U) : ((poly.low >> 1U) | (1ULL << (poly.order - 1U)));
+}
+
+// Degree of the coefficients, value != 0.
+static uint8_t api_crc_polyDegree(uint64_t const value)
+{
+    return 63U - __builtin_clzll(value);
+}
+
+// Polynomial of the coefficients, value != 0.
+static api_crc_poly_s api_crc_polyOfCoefficients(uint64_t const value)
+{
+    api_crc_poly_s poly;
+
+    poly.order = api_crc_polyDegree(value);
+    poly.low = value ^ (1ULL << poly.order);
+    return poly;
+}
+
+// Coefficients of the terms below x^64 of the polynomial.
+static uint64_t api_crc_polyCoefficients(api_crc_poly_s const poly)
+{
+    return (poly.order < 64U) ? (poly.low | (1ULL << poly.order)) : (poly.low);
+}
+
+// Remainder of the coefficients a modulo the coefficients b != 0.
+static uint64_t api_crc_polyRemainder(uint64_t a, uint64_t const b)
+{
+    uint8_t const degree = api_crc_polyDegree(b);
+
+    while((a != 0U) && (api_crc_polyDegree(a) >= degree))
+    {
+        a ^= b << (api_crc_polyDegree(a) - degree);
+    }
+
+    return a;
+}
+
+// Remainder of the coefficients modulo P.
+static uint64_t api_crc_polyReduce(uint64_t const value, api_crc_poly_s const poly)
+{
+    return (poly.order < 64U) ? (api_crc_polyRemainder(value, api_crc_polyCoefficients(poly))) : (value);
+}
+
+// Product a * b modulo P of the remainders a and b.
+static uint64_t api_crc_polyMultiplyModOf(uint64_t const a, uint64_t const b, api_crc_poly_s const poly)
+{
+    uint64_t const top = 1ULL << (poly.order - 1U);
+    uint64_t product = 0U;
+    uint8_t counter = 0U;
+
+    for(counter = (b == 0U) ? (0U) : (api_crc_polyDegree(b) + 1U); counter > 0U; counter--)
+    {
+        product = ((product & top) != 0U) ? (((product ^ top) << 1U) ^ poly.low) : (product << 1U);
+        product ^= (((b >> (counter - 1U)) & 1U) != 0U) ? (a) : (0U);
+    }
+
+    return product;
+}
+
+// Power base^exponent modulo P of the remainder base, by squaring and multiplying.
+static uint64_t api_crc_polyPowerModOf(uint64_t const base, uint64_t const exponent, api_crc_poly_s const poly)
+{
+    uint64_t power = 1U;
+    uint8_t counter = 0U;
+
+    for(counter = (exponent == 0U) ? (0U) : (api_crc_polyDegree(exponent) + 1U); counter > 0U; counter--)
+    {
+        power = api_crc_polyMultiplyModOf(power, power, poly);
+
+        if(((exponent >> (counter - 1U)) & 1U) != 0U)
+        {
+            power = api_crc_polyMultiplyModOf(power, base, poly);
+        }
+    }
+
+    return power;
+}
+
+// Greatest common divisor of P and the remainder a by the Euclidean algorithm.
+static api_crc_poly_s api_crc_polyGcdOf(api_crc_poly_s const poly, uint64_t a)
+{
+    uint64_t remainder = 0U;
+    uint64_t b = 0U;
+    uint8_t counter = 0U;
+    uint8_t degree = 0U;
+
+    if(a == 0U)
+    {
+        return poly;
+    }
+
+    // P modulo a by Horner's method, the term x^order included
+    degree = api_crc_polyDegree(a);
+
+    for(counter = poly.order + 1U; counter > 0U; counter--)
+    {
+        b = (b << 1U) | (((counter - 1U) == poly.order) ? (1U) : ((poly.low >> (counter - 1U)) & 1U));
+        b ^= (((b >> degree) & 1U) != 0U) ? (a) : (0U);
+    }
+
+    while(b != 0U)
+    {
+        remainder = api_crc_polyRemainder(a, b);
+        a = b;
+        b = remainder;
+    }
+
+    return api_crc_polyOfCoefficients(a);
+}
+
+// Greatest common divisor of two polynomials.
+static api_crc_poly_s api_crc_polyGcdOfTwo(api_crc_poly_s const a, api_crc_poly_s const b)
+{
+    if(a.order < b.order)
+    {
+        return api_crc_polyGcdOf(b, api_crc_polyCoefficients(a));
+    }
+
+    // a - b is a remainder modulo a of the same order
+    return api_crc_polyGcdOf(a, (a.order == b.order) ? (a.low ^ b.low) : (api_crc_polyCoefficients(b)));
+}
+
+// Quotient of P and its divisor. Both have the term x^0, so the coefficients of the
+// quotient follow from the lowest terms on.
+static api_crc_poly_s api_crc_polyDivide(api_crc_poly_s const poly, api_crc_poly_s const divisor)
+{
+    uint64_t const coefficients = api_crc_polyCoefficients(divisor);
+    uint64_t remainder = api_crc_polyCoefficients(poly);
+    uint64_t quotient = 0U;
+    uint8_t counter = 0U;
+
+    if(divisor.order == 0U)
+    {
+        return poly;
+    }
+
+    if(divisor.order == poly.order)
+    {
+        return api_crc_polyOf(0U);
+    }
+
+    for(counter = 0U; counter <= (poly.order - divisor.order); counter++)
+    {
+        if(((remainder >> counter) & 1U) != 0U)
+        {
+            quotient |= 1ULL << counter;
+            remainder ^= coefficients << counter;
+        }
+    }
+
+    return api_crc_polyOfCoefficients(quotient);
+}
+
+// Square root of a polynomial of even powers only.
+static api_crc_poly_s api_crc_polySquareRoot(api_crc_poly_s const poly)
+{
+    api_crc_poly_s root = {0U, poly.order >> 1U};
+    uint8_t counter = 0U;
+
+    for(counter = 0U; counter < root.order; counter++)
+    {
+        root.low |= ((poly.low >> (counter << 1U)) & 1U) << counter;
+    }
+
+    return root;
+}
+
+// Adds the factor of the given multiplicity to the list of the factors.
+static void api_crc_polyAppend(api_crc_poly_s const factor, uint8_t const multiplicity, api_crc_poly_s *const factors, uint8_t *const multiplicities, uint8_t *const count)
+{
+    factors[*count] = factor;
+    multiplicities[*count] = multiplicity;
+    (*count)++;
+}
+
+// Irreducible factors of the degree of a square-free product by Cantor-Zassenhaus:
+// the trace a + a^2 + ... + a^(2^(degree-1)) of a random a is 0 or 1 modulo each
+// factor, its common divisor with the product splits off a part of the factors.
+static void api_crc_polySplit(api_crc_poly_s const poly, uint8_t const degree, uint8_t const multiplicity, api_crc_poly_s *const factors, uint8_t *const multiplicities, uint8_t *const count)
+{
+    api_crc_poly_s stack[API_CRC_POLY_FACTORS];
+    api_crc_poly_s current;
+    api_crc_poly_s divisor;
+    uint64_t random = 0x9E3779B97F4A7C15ULL;
+    uint64_t square = 0U;
+    uint64_t trace = 0U;
+    uint8_t size = 1U;
+    uint8_t counter = 0U;
+
+    stack[0U] = poly;
+
+    while(size > 0U)
+    {
+        current = stack[--size];
+
+        if(current.order == degree)
+        {
+            api_crc_polyAppend(current, multiplicity, factors, multiplicities, count);
+        }
+        else
+        {
+            do
+            {
+                random ^= random << 13U;
+                random ^= random >> 7U;
+                random ^= random << 17U;
+                square = api_crc_polyReduce(random, current);
+                trace = square;
+
+                for(counter = 1U; counter < degree; counter++)
+                {
+                    square = api_crc_polyMultiplyModOf(square, square, current);
+                    trace ^= square;
+                }
+
+                divisor = api_crc_polyGcdOf(current, trace);
+            }
+            while((divisor.order == 0U) || (divisor.order == current.order));
+
+            stack[size++] = divisor;
+            stack[size++] = api_crc_polyDivide(current, divisor);
+        }
+    }
+}
+
+// Irreducible factors of a square-free polynomial by the distinct-degree factorization:
+// the common divisor of P and x^(2^degree) - x is the product of the factors of the degree.
+static void api_crc_polyDistinctDegree(api_crc_poly_s poly, uint8_t const multiplicity, api_crc_poly_s *const factors, uint8_t *const multiplicities, uint8_t *const count)
+{
+    api_crc_poly_s divisor;
+    uint64_t power = api_crc_polyReduce(2U, poly);
+    uint8_t degree = 0U;
+
+    for(degree = 1U; (degree << 1U) <= poly.order; degree++)
+    {
+        power = api_crc_polyMultiplyModOf(power, power, poly);
+        divisor = api_crc_polyGcdOf(poly, power ^ api_crc_polyReduce(2U, poly));
+
+        if(divisor.order > 0U)
+        {
+            api_crc_polySplit(divisor, degree, multiplicity, factors, multiplicities, count);
+            poly = api_crc_polyDivide(poly, divisor);
+            power = api_crc_polyReduce(power, poly);
+        }
+    }
+
+    if(poly.order > 0U)
+    {
+        api_crc_polyAppend(poly, multiplicity, factors, multiplicities, count);
+    }
+}
+
+// Irreducible factors of P and their multiplicities. The square-free decomposition
+// of Yun splits P by the common divisors with its derivative, the remaining squares
+// are factorized by their square root.
+static uint8_t api_crc_polyFactorOf(api_crc_poly_s poly, api_crc_poly_s *const factors, uint8_t *const multiplicities)
+{
+    api_crc_poly_s common;
+    api_crc_poly_s divisor;
+    api_crc_poly_s squareFree;
+    api_crc_poly_s rest;
+    uint8_t count = 0U;
+    uint8_t square = 1U;
+    uint8_t multiplicity = 0U;
+
+    while(poly.order > 0U)
+    {
+        // the derivative has the odd powers of P only
+        common = api_crc_polyGcdOf(poly, (api_crc_polyCoefficients(poly) >> 1U) & 0x5555555555555555ULL);
+        rest = api_crc_polyDivide(poly, common);
+
+        for(multiplicity = 1U; rest.order > 0U; multiplicity++)
+        {
+            divisor = api_crc_polyGcdOfTwo(rest, common);
+            squareFree = api_crc_polyDivide(rest, divisor);
+
+            if(squareFree.order > 0U)
+            {
+                api_crc_polyDistinctDegree(squareFree, multiplicity * square, factors, multiplicities, &count);
+            }
+
+            rest = divisor;
+            common = api_crc_polyDivide(common, divisor);
+        }
+
+        poly = api_crc_polySquareRoot(common);
+        square <<= 1U;
+    }
+
+    return count;
+}
+
+// Period of the irreducible polynomial P, the smallest e with x^e = 1 modulo P,
+// which divides 2^order - 1.
+static uint64_t api_crc_polyPeriodOf(api_crc_poly_s const poly)
+{
+    uint64_t const x = api_crc_polyReduce(2U, poly);
+    uint64_t period = -1ULL >> ((sizeof(period) << 3U) - poly.order);
+    uint8_t counter = 0U;
+
+    for(counter = 0U; counter < (sizeof(api_crc_polyPrimes) / sizeof(api_crc_polyPrimes[0U])); counter++)
+    {
+        while(((period % api_crc_polyPrimes[counter]) == 0U)
+                && (api_crc_polyPowerModOf(x, period / api_crc_polyPrimes[counter], poly) == 1U))
+        {
+            period /= api_crc_polyPrimes[counter];
+        }
+    }
+
+    return period;
+}
+
+// Greatest common divisor of two integers.
+static uint64_t api_crc_polyGcdOfIntegers(uint64_t a, uint64_t b)
+{
+    uint64_t remainder = 0U;
+
+    while(b != 0U)
+    {
+        remainder = a % b;
+        a = b;
+        b = remainder;
+    }
+
+    return a;
+}
+
+//------------------------------------------------------------------------------
+// Public Functions
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function multiplies two polynomials in the notation of ::api_crc_init.
+//!
+//! \details
+//! The product of polynomials with the term x^0 has the term x^0 as well, so the
+//! notation of ::api_crc_init holds for the product of an order up to 64.
+//!
+//! \param[in] polynomialA The first polynomial in the notation of ::api_crc_init, 0 is the polynomial 1.
+//!
+//! \param[in] polynomialB The second polynomial in the notation of ::api_crc_init.
+//!
+//! \param[out] *product The product in the notation of ::api_crc_init.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyMultiply"];
+//!
+//! CALLER=>FU[label = "api_crc_polyMultiply(polynomialA, polynomialB, product)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC-16: (x + 1) * (x^15 + x + 1) = x^16 + x^15 + x^2 + 1
+//! uint64_t product = 0U;
+//! api_crc_status_e status = api_crc_polyMultiply(0x1U, 0x4001U, &product);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The order of the product is at most 64.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyMultiply(uint64_t const polynomialA, uint64_t const polynomialB, uint64_t *const product)
+{
+    api_crc_poly_s const a = api_crc_polyOf(polynomialA);
+    api_crc_poly_s const b = api_crc_polyOf(polynomialB);
+    api_crc_poly_s result = {0U, 0U};
+    uint64_t coefficients = 0U;
+    uint64_t multiplier = 0U;
+
+    if((product == NULL) || ((a.order + b.order) > 64U))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    // the carry-less product of the coefficients below x^64, the term x^64 is implied
+    for(multiplier = api_crc_polyCoefficients(b); multiplier != 0U; multiplier &= multiplier - 1U)
+    {
+        coefficients ^= api_crc_polyCoefficients(a) << __builtin_ctzll(multiplier);
+    }
+
+    result.order = a.order + b.order;
+    result.low = coefficients ^ ((result.order < 64U) ? (1ULL << result.order) : (0U));
+    (*product) = api_crc_polyNotation(result);
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the greatest common divisor of two polynomials in the
+//! notation of ::api_crc_init.
+//!
+//! \details
+//! The divisor is computed by the Euclidean algorithm. Two generator polynomials are
+//! coprime, if the divisor is 0, i.e. the polynomial 1.
+//!
+//! \param[in] polynomialA The first polynomial in the notation of ::api_crc_init, 0 is the polynomial 1.
+//!
+//! \param[in] polynomialB The second polynomial in the notation of ::api_crc_init.
+//!
+//! \param[out] *gcd The greatest common divisor in the notation of ::api_crc_init.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyGcd"];
+//!
+//! CALLER=>FU[label = "api_crc_polyGcd(polynomialA, polynomialB, gcd)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC-16 and CRC-16/CCITT share the factor x + 1
+//! uint64_t gcd = 0U;
+//! api_crc_status_e status = api_crc_polyGcd(0xC002U, 0x8810U, &gcd);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyGcd(uint64_t const polynomialA, uint64_t const polynomialB, uint64_t *const gcd)
+{
+    if(gcd == NULL)
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*gcd) = api_crc_polyNotation(api_crc_polyGcdOfTwo(api_crc_polyOf(polynomialA), api_crc_polyOf(polynomialB)));
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the remainder of a polynomial modulo the generator polynomial.
+//!
+//! \details
+//! The polynomial and the remainder are given by their coefficients, the bit i is
+//! the coefficient of the term x^i, so the degree is at most 63.
+//!
+//! \param[in] value The coefficients of the polynomial.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *remainder The coefficients of the remainder.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyMod"];
+//!
+//! CALLER=>FU[label = "api_crc_polyMod(value, polynomial, remainder)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // x^32 modulo the generator polynomial of CRC-32
+//! uint64_t remainder = 0U;
+//! api_crc_status_e status = api_crc_polyMod(1ULL << 32U, 0x82608EDBU, &remainder);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyMod(uint64_t const value, uint64_t const polynomial, uint64_t *const remainder)
+{
+    if((polynomial == 0U) || (remainder == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*remainder) = api_crc_polyReduce(value, api_crc_polyOf(polynomial));
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the product of two polynomials modulo the generator polynomial.
+//!
+//! \details
+//! The factors and the product are given by their coefficients (see ::api_crc_polyMod).
+//!
+//! \param[in] a The coefficients of the first factor.
+//!
+//! \param[in] b The coefficients of the second factor.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *product The coefficients of the product modulo the generator polynomial.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyMultiplyMod"];
+//!
+//! CALLER=>FU[label = "api_crc_polyMultiplyMod(a, b, polynomial, product)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // x^31 * x modulo the generator polynomial of CRC-32
+//! uint64_t product = 0U;
+//! api_crc_status_e status = api_crc_polyMultiplyMod(1ULL << 31U, 2U, 0x82608EDBU, &product);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyMultiplyMod(uint64_t const a, uint64_t const b, uint64_t const polynomial, uint64_t *const product)
+{
+    api_crc_poly_s const poly = api_crc_polyOf(polynomial);
+
+    if((polynomial == 0U) || (product == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*product) = api_crc_polyMultiplyModOf(api_crc_polyReduce(a, poly), api_crc_polyReduce(b, poly), poly);
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the power of a polynomial modulo the generator polynomial.
+//!
+//! \details
+//! The power is computed by squaring and multiplying, the base and the power are
+//! given by their coefficients (see ::api_crc_polyMod).
+//!
+//! \param[in] base The coefficients of the base.
+//!
+//! \param[in] exponent The exponent.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *power The coefficients of the power modulo the generator polynomial.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyPowerMod"];
+//!
+//! CALLER=>FU[label = "api_crc_polyPowerMod(base, exponent, polynomial, power)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // x^(2^32 - 1) = 1 modulo the primitive generator polynomial of CRC-32
+//! uint64_t power = 0U;
+//! api_crc_status_e status = api_crc_polyPowerMod(2U, 0xFFFFFFFFU, 0x82608EDBU, &power);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyPowerMod(uint64_t const base, uint64_t const exponent, uint64_t const polynomial, uint64_t *const power)
+{
+    api_crc_poly_s const poly = api_crc_polyOf(polynomial);
+
+    if((polynomial == 0U) || (power == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    (*power) = api_crc_polyPowerModOf(api_crc_polyReduce(base, poly), exponent, poly);
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function factorizes the generator polynomial into irreducible polynomials.
+//!
+//! \details
+//! The square-free decomposition of Yun splits off the repeated factors, the
+//! distinct-degree factorization groups the factors by their degree and the algorithm
+//! of Cantor-Zassenhaus splits the factors of equal degree. The factors are sorted in
+//! ascending order, a factor of the multiplicity m is listed m times.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *factors The irreducible factors in the notation of ::api_crc_init,
+//! an array of ::API_CRC_POLY_FACTORS entries.
+//!
+//! \param[out] *count The number of the factors.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyFactor"];
+//!
+//! CALLER=>FU[label = "api_crc_polyFactor(polynomial, factors, count)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC-16 = (x + 1) * (x^15 + x + 1): factors = {0x1, 0x4001}
+//! uint64_t factors[API_CRC_POLY_FACTORS];
+//! uint8_t count = 0U;
+//! api_crc_status_e status = api_crc_polyFactor(0xC002U, factors, &count);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyFactor(uint64_t const polynomial, uint64_t *const factors, uint8_t *const count)
+{
+    api_crc_poly_s irreducible[API_CRC_POLY_FACTORS];
+    uint8_t multiplicities[API_CRC_POLY_FACTORS];
+    uint64_t factor = 0U;
+    uint8_t number = 0U;
+    uint8_t counter = 0U;
+    uint8_t index = 0U;
+
+    if((polynomial == 0U) || (factors == NULL) || (count == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    number = api_crc_polyFactorOf(api_crc_polyOf(polynomial), irreducible, multiplicities);
+    (*count) = 0U;
+
+    for(counter = 0U; counter < number; counter++)
+    {
+        factor = api_crc_polyNotation(irreducible[counter]);
+
+        for(index = 0U; index < multiplicities[counter]; index++)
+        {
+            factors[(*count)++] = factor;
+        }
+    }
+
+    // insertion sort of the factors
+    for(counter = 1U; counter < (*count); counter++)
+    {
+        factor = factors[counter];
+
+        for(index = counter; (index > 0U) && (factors[index - 1U] > factor); index--)
+        {
+            factors[index] = factors[index - 1U];
+        }
+
+        factors[index] = factor;
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the period of the generator polynomial, the smallest e
+//! with x^e = 1 modulo the polynomial.
+//!
+//! \details
+//! The period of an irreducible factor of the order d divides 2^d - 1 and follows
+//! from the prime factors of 2^d - 1. The period of the polynomial is the least common
+//! multiple of the periods of its factors, times the smallest power of 2 which is not
+//! less than the largest multiplicity. A CRC detects all 2-bit errors within a codeword
+//! of up to period bits.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *period The period of the polynomial.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyPeriod"];
+//!
+//! CALLER=>FU[label = "api_crc_polyPeriod(polynomial, period)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // CRC-16: period = 32767
+//! uint64_t period = 0U;
+//! api_crc_status_e status = api_crc_polyPeriod(0xC002U, &period);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyPeriod(uint64_t const polynomial, uint64_t *const period)
+{
+    api_crc_poly_s irreducible[API_CRC_POLY_FACTORS];
+    uint8_t multiplicities[API_CRC_POLY_FACTORS];
+    uint64_t factor = 0U;
+    uint8_t maximum = 1U;
+    uint8_t number = 0U;
+    uint8_t counter = 0U;
+
+    if((polynomial == 0U) || (period == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    number = api_crc_polyFactorOf(api_crc_polyOf(polynomial), irreducible, multiplicities);
+    (*period) = 1U;
+
+    for(counter = 0U; counter < number; counter++)
+    {
+        factor = api_crc_polyPeriodOf(irreducible[counter]);
+        (*period) = ((*period) / api_crc_polyGcdOfIntegers((*period), factor)) * factor;
+        maximum = (multiplicities[counter] > maximum) ? (multiplicities[counter]) : (maximum);
+    }
+
+    for(counter = 1U; counter < maximum; counter <<= 1U)
+    {
+        (*period) <<= 1U;
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function checks whether the generator polynomial is irreducible.
+//!
+//! \details
+//! The test of Ben-Or: P of the order n is irreducible, if it is coprime to
+//! x^(2^d) - x for all d up to n / 2, i.e. it has no factor of the degree d.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *irreducible 1 if the polynomial is irreducible, otherwise 0.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyIsIrreducible"];
+//!
+//! CALLER=>FU[label = "api_crc_polyIsIrreducible(polynomial, irreducible)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! uint8_t irreducible = 0U;
+//! api_crc_status_e status = api_crc_polyIsIrreducible(0x82608EDBU, &irreducible);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyIsIrreducible(uint64_t const polynomial, uint8_t *const irreducible)
+{
+    api_crc_poly_s const poly = api_crc_polyOf(polynomial);
+    uint64_t x = 0U;
+    uint64_t power = 0U;
+    uint8_t degree = 0U;
+
+    if((polynomial == 0U) || (irreducible == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    x = api_crc_polyReduce(2U, poly);
+    power = x;
+    (*irreducible) = 1U;
+
+    for(degree = 1U; ((*irreducible) != 0U) && ((degree << 1U) <= poly.order); degree++)
+    {
+        power = api_crc_polyMultiplyModOf(power, power, poly);
+        (*irreducible) = (api_crc_polyGcdOf(poly, power ^ x).order == 0U);
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function checks whether the generator polynomial is primitive.
+//!
+//! \details
+//! An irreducible polynomial of the order n is primitive, if its period is 2^n - 1,
+//! i.e. x^((2^n - 1) / p) is not 1 modulo the polynomial for all prime factors p of
+//! 2^n - 1. A CRC of a primitive polynomial detects all 2-bit errors within a codeword
+//! of up to 2^n - 1 bits.
+//!
+//! \param[in] polynomial The generator polynomial in the notation of ::api_crc_init, the leading
+//! bit is the term x^order and the term x^0 is implied.
+//!
+//! \param[out] *primitive 1 if the polynomial is primitive, otherwise 0.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_polyIsPrimitive"];
+//!
+//! CALLER=>FU[label = "api_crc_polyIsPrimitive(polynomial, primitive)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! uint8_t primitive = 0U;
+//! api_crc_status_e status = api_crc_polyIsPrimitive(0x82608EDBU, &primitive);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! Nothing.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_polyIsPrimitive(uint64_t const polynomial, uint8_t *const primitive)
+{
+    api_crc_poly_s const poly = api_crc_polyOf(polynomial);
+    uint64_t x = 0U;
+    uint64_t period = 0U;
+    uint8_t counter = 0U;
+
+    if((polynomial == 0U) || (primitive == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    x = api_crc_polyReduce(2U, poly);
+    period = -1ULL >> ((sizeof(period) << 3U) - poly.order);
+    api_crc_polyIsIrreducible(polynomial, primitive);
+
+    for(counter = 0U; ((*primitive) != 0U) && (counter < (sizeof(api_crc_polyPrimes) / sizeof(api_crc_polyPrimes[0U]))); counter++)
+    {
+        (*primitive) = ((period % api_crc_polyPrimes[counter]) != 0U)
+                       || (api_crc_polyPowerModOf(x, period / api_crc_polyPrimes[counter], poly) != 1U);
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
@@ -0,0 +1,194 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+#ifndef __API_CRC_PRIVATE_H__
+#define __API_CRC_PRIVATE_H__
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "../inc/api_crc.h"
+#include "../cfg/api_crc_cfg.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+#ifndef API_CRC_IOVEC
+struct iovec;	// Segments of api_crc_processv, the vector is always NULL without them.
+#endif // API_CRC_IOVEC
+
+//------------------------------------------------------------------------------
+// Inline Functions
+//------------------------------------------------------------------------------
+
+// The helpers shared by the engines of the library (api_crc.c, api_crc_process.c,
+// api_crc_chunk.c and api_crc_stream.c), which must not drift apart.
+
+// Bits of the value in the reverse order.
+static inline uint64_t api_crc_reverse64(uint64_t const value)
+{
+    uint64_t temp = value;
+
+    temp = ((temp >>  1U) & 0x5555555555555555U) | ((temp & 0x5555555555555555U) <<  1U);
+    temp = ((temp >>  2U) & 0x3333333333333333U) | ((temp & 0x3333333333333333U) <<  2U);
+    temp = ((temp >>  4U) & 0x0F0F0F0F0F0F0F0FU) | ((temp & 0x0F0F0F0F0F0F0F0FU) <<  4U);
+    temp = ((temp >>  8U) & 0x00FF00FF00FF00FFU) | ((temp & 0x00FF00FF00FF00FFU) <<  8U);
+    temp = ((temp >> 16U) & 0x0000FFFF0000FFFFU) | ((temp & 0x0000FFFF0000FFFFU) << 16U);
+    temp = ((temp >> 32U) & 0x00000000FFFFFFFFU) | ((temp & 0x00000000FFFFFFFFU) << 32U);
+    return temp;
+}
+
+// Entry of the given width (in bytes) from the table, right aligned in the register.
+// The width is a constant in the callers, so the switch is resolved at compile time.
+static inline __attribute__((always_inline)) api_crc_register_t api_crc_readEntry(uint64_t const *const table, uint8_t const width, uint32_t const index)
+{
+    api_crc_register_t entry = 0U;
+
+    switch(width)
+    {
+    case sizeof(uint8_t):
+        entry = ((uint8_t const *const)table)[index];
+        break;
+    case sizeof(uint16_t):
+        entry = ((uint16_t const *const)table)[index];
+        break;
+    case sizeof(uint32_t):
+        entry = ((uint32_t const *const)table)[index];
+        break;
+    default:
+        entry = (api_crc_register_t)(((uint64_t const *const)table)[index]);
+        break;
+    }
+
+    return entry;
+}
+
+// Register after one more input byte, by the byte table with entries of width bytes.
+static inline __attribute__((always_inline)) api_crc_register_t api_crc_processByteOf(uint64_t const *const table, api_crc_register_t const reg, uint8_t const byte,
+        uint8_t const width, uint8_t const reverse)
+{
+    if(reverse != 0U)
+    {
+        return (reg >> 8U) ^ api_crc_readEntry(table, width, (uint8_t)reg ^ byte);
+    }
+
+    return (reg << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(reg >> ((sizeof(api_crc_register_t) - 1U) << 3U)) ^ byte) << ((sizeof(api_crc_register_t) - width) << 3U));
+}
+
+// Register after the bytes, by the table of 16 entries with two lookups per byte.
+static inline __attribute__((always_inline)) void api_crc_processForwardNibbleOf(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint8_t const shift = (sizeof(api_crc_register_t) - width) << 3U;
+    uint8_t const top = (sizeof(api_crc_register_t) << 3U) - 4U;
+    api_crc_register_t crc = (*reg);
+    uint32_t counter = 0U;
+
+    for(counter = 0U; counter < size; counter++)
+    {
+        crc = (crc << 4U) ^ (api_crc_readEntry(device->table, width, (uint8_t)(crc >> top) ^ (buffer[counter] >> 4U)) << shift);
+        crc = (crc << 4U) ^ (api_crc_readEntry(device->table, width, (uint8_t)(crc >> top) ^ (buffer[counter] & 0x0FU)) << shift);
+    }
+
+    (*reg) = crc;
+}
+
+static inline __attribute__((always_inline)) void api_crc_processReverseNibbleOf(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_register_t crc = (*reg);
+    uint32_t counter = 0U;
+
+    for(counter = 0U; counter < size; counter++)
+    {
+        crc = (crc >> 4U) ^ api_crc_readEntry(device->table, width, (uint8_t)(crc & 0x0FU) ^ (buffer[counter] & 0x0FU));
+        crc = (crc >> 4U) ^ api_crc_readEntry(device->table, width, (uint8_t)(crc & 0x0FU) ^ (buffer[counter] >> 4U));
+    }
+
+    (*reg) = crc;
+}
+
+// Lower 64 bits of the carry-less product without instructions of the CPU. The
+// integer products of every fourth bit have holes of three bits for the carries
+// of at most 15 terms.
+static inline uint64_t api_crc_clmulLow(uint64_t const a, uint64_t const b)
+{
+    uint64_t const a0 = a & 0x1111111111111111U;
+    uint64_t const a1 = a & 0x2222222222222222U;
+    uint64_t const a2 = a & 0x4444444444444444U;
+    uint64_t const a3 = a & 0x8888888888888888U;
+    uint64_t const b0 = b & 0x1111111111111111U;
+    uint64_t const b1 = b & 0x2222222222222222U;
+    uint64_t const b2 = b & 0x4444444444444444U;
+    uint64_t const b3 = b & 0x8888888888888888U;
+    uint64_t const c0 = (a0 * b0) ^ (a1 * b3) ^ (a2 * b2) ^ (a3 * b1);
+    uint64_t const c1 = (a0 * b1) ^ (a1 * b0) ^ (a2 * b3) ^ (a3 * b2);
+    uint64_t const c2 = (a0 * b2) ^ (a1 * b1) ^ (a2 * b0) ^ (a3 * b3);
+    uint64_t const c3 = (a0 * b3) ^ (a1 * b2) ^ (a2 * b1) ^ (a3 * b0);
+
+    return (c0 & 0x1111111111111111U) | (c1 & 0x2222222222222222U) | (c2 & 0x4444444444444444U) | (c3 & 0x8888888888888888U);
+}
+
+// Upper 64 bits of the carry-less product, the product of the reflected factors
+// is the reflected product shifted by one bit.
+static inline uint64_t api_crc_clmulHigh(uint64_t const a, uint64_t const b)
+{
+    return api_crc_reverse64(api_crc_clmulLow(api_crc_reverse64(a), api_crc_reverse64(b)) << 1U);
+}
+
+// State register of the device as a register of the CPU, forward registers are left-aligned.
+static inline api_crc_register_t api_crc_stateRegister(api_crc_device_s const *const device, api_crc_state_t const state)
+{
+    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    {
+        return (api_crc_register_t)state;
+    }
+
+    return (api_crc_register_t)(state >> ((sizeof(api_crc_state_t) - sizeof(api_crc_register_t)) << 3U));
+}
+
+// Register of the CPU back as the state register of the device.
+static inline api_crc_state_t api_crc_registerState(api_crc_device_s const *const device, api_crc_register_t const reg)
+{
+    if(device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT)
+    {
+        return (api_crc_state_t)reg;
+    }
+
+    return (api_crc_state_t)reg << ((sizeof(api_crc_state_t) - sizeof(api_crc_register_t)) << 3U);
+}
+
+#endif // __API_CRC_PRIVATE_H__
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
@@ -26,11 +26,20 @@
 //------------------------------------------------------------------------------
 
 #include "../inc/api_crc_process.h"
+#include "api_crc_private.h"
+
+#ifdef API_CRC_CLMUL
+#include <immintrin.h>
+#endif
 
 //------------------------------------------------------------------------------
 // Preprocessor
 //------------------------------------------------------------------------------
 
+#ifdef API_CRC_CLMUL
+#define API_CRC_TARGET_VPCLMUL "avx512f,avx512bw,avx512vl,vpclmulqdq,pclmul,ssse3,sse4.1"	// Instruction sets of the 512-bit folding.
+#endif
+
 //------------------------------------------------------------------------------
 // Private Enums
 //------------------------------------------------------------------------------
@@ -47,6 +56,10 @@
 // Private Data
 //------------------------------------------------------------------------------
 
+#ifdef API_CRC_CLMUL
+static int8_t api_crc_engines = -1;	// Engines supported by the CPU as bits (1 << api_crc_engine_e), -1 if not yet queried.
+#endif
+
 //------------------------------------------------------------------------------
 // Public Data
 //------------------------------------------------------------------------------
@@ -55,6 +68,569 @@
 // Private Functions
 //------------------------------------------------------------------------------
 
+// Product of two registers modulo the polynomial x^(64-n) * P of the register,
+// the upper half is reduced with the Barrett constants of the device.
+static api_crc_register_t api_crc_multiplyForward(api_crc_device_s const *const device, api_crc_register_t const a, api_crc_register_t const b)
+{
+    uint64_t const low = api_crc_clmulLow(a, b);
+    uint64_t const high = api_crc_clmulHigh(a, b);
+    uint64_t const quotient = high ^ api_crc_clmulHigh(high, device->fold[API_CRC_FOLD_MU]);
+
+    return (api_crc_register_t)(low ^ api_crc_clmulLow(quotient, device->fold[API_CRC_FOLD_POLYNOMIAL]));
+}
+
+// The product of two reflected registers is the reflected product shifted by one bit.
+static api_crc_register_t api_crc_multiplyReverse(api_crc_device_s const *const device, api_crc_register_t const a, api_crc_register_t const b)
+{
+    // term x^0 of the polynomial x^(64-n) * P, set only for a CRC-64
+    uint64_t const constant = (uint64_t)0U - ((uint64_t)device->polynomial >> 63U);
+    uint64_t const low = api_crc_clmulLow(a, b);
+    uint64_t const high = (api_crc_clmulHigh(a, b) << 1U) | (low >> 63U);
+    uint64_t const quotient = api_crc_clmulLow(low << 1U, device->fold[API_CRC_FOLD_MU]);
+
+    return (api_crc_register_t)(high ^ api_crc_clmulHigh(quotient, device->fold[API_CRC_FOLD_POLYNOMIAL]) ^ (quotient & constant));
+}
+
+// Shift of a register over one lane, x^(8 * API_CRC_LANE_SIZE) mod P: the folding
+// constant of 2048 bits squared twice.
+static api_crc_register_t api_crc_laneForward(api_crc_device_s const *const device)
+{
+    api_crc_register_t distance = device->fold[API_CRC_FOLD_2048_LOW];
+
+    distance = api_crc_multiplyForward(device, distance, distance);
+    return api_crc_multiplyForward(device, distance, distance);
+}
+
+// The reflected constant x^2047 mod P is multiplied by x.
+static api_crc_register_t api_crc_laneReverse(api_crc_device_s const *const device)
+{
+    api_crc_register_t distance = device->fold[API_CRC_FOLD_2048_HIGH];
+
+    distance = (distance >> 1U) ^ ((distance & 1U) ? (device->polynomial) : (0U));
+    distance = api_crc_multiplyReverse(device, distance, distance);
+    return api_crc_multiplyReverse(device, distance, distance);
+}
+
+// Table of 256 entries, one lookup per input byte. The width is a constant in every caller, so the
+// table read is inlined without an indirect call per byte. Blocks of three lanes are looked up
+// interleaved in independent registers and merged as A * x^(16L) + B * x^(8L) + C.
+static inline __attribute__((always_inline)) void api_crc_processForwardLUTOf(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const *const table = device->table;
+    uint8_t const shift = (sizeof(api_crc_register_t) - width) << 3U;
+    uint8_t const top = (sizeof(api_crc_register_t) - sizeof(buffer[0U])) << 3U;
+    api_crc_register_t crc = (*reg);
+    api_crc_register_t lane1 = 0U;
+    api_crc_register_t lane2 = 0U;
+    api_crc_register_t distance = 0U;
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+    uint32_t index = 0U;
+
+    // the constants are missing in a device of the macro API_CRC_INIT
+    if((counter >= (3U * API_CRC_LANE_SIZE)) && (device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U))
+    {
+        distance = api_crc_laneForward(device);
+
+        while(counter >= (3U * API_CRC_LANE_SIZE))
+        {
+            lane1 = 0U;
+            lane2 = 0U;
+
+            for(index = 0U; index < API_CRC_LANE_SIZE; index++)
+            {
+                crc = (crc << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(crc >> top) ^ data[index]) << shift);
+                lane1 = (lane1 << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(lane1 >> top) ^ data[index + API_CRC_LANE_SIZE]) << shift);
+                lane2 = (lane2 << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(lane2 >> top) ^ data[index + (API_CRC_LANE_SIZE << 1U)]) << shift);
+            }
+
+            crc = api_crc_multiplyForward(device, api_crc_multiplyForward(device, crc, distance) ^ lane1, distance) ^ lane2;
+            data += 3U * API_CRC_LANE_SIZE;
+            counter -= 3U * API_CRC_LANE_SIZE;
+        }
+    }
+
+    for(index = 0U; index < counter; index++)
+    {
+        crc = (crc << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(crc >> top) ^ data[index]) << shift);
+    }
+
+    (*reg) = crc;
+}
+
+static inline __attribute__((always_inline)) void api_crc_processReverseLUTOf(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const *const table = device->table;
+    api_crc_register_t crc = (*reg);
+    api_crc_register_t lane1 = 0U;
+    api_crc_register_t lane2 = 0U;
+    api_crc_register_t distance = 0U;
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+    uint32_t index = 0U;
+
+    if((counter >= (3U * API_CRC_LANE_SIZE)) && (device->fold[API_CRC_FOLD_POLYNOMIAL] != 0U))
+    {
+        distance = api_crc_laneReverse(device);
+
+        while(counter >= (3U * API_CRC_LANE_SIZE))
+        {
+            lane1 = 0U;
+            lane2 = 0U;
+
+            for(index = 0U; index < API_CRC_LANE_SIZE; index++)
+            {
+                crc = (crc >> 8U) ^ api_crc_readEntry(table, width, (uint8_t)crc ^ data[index]);
+                lane1 = (lane1 >> 8U) ^ api_crc_readEntry(table, width, (uint8_t)lane1 ^ data[index + API_CRC_LANE_SIZE]);
+                lane2 = (lane2 >> 8U) ^ api_crc_readEntry(table, width, (uint8_t)lane2 ^ data[index + (API_CRC_LANE_SIZE << 1U)]);
+            }
+
+            crc = api_crc_multiplyReverse(device, api_crc_multiplyReverse(device, crc, distance) ^ lane1, distance) ^ lane2;
+            data += 3U * API_CRC_LANE_SIZE;
+            counter -= 3U * API_CRC_LANE_SIZE;
+        }
+    }
+
+    for(index = 0U; index < counter; index++)
+    {
+        crc = (crc >> 8U) ^ api_crc_readEntry(table, width, (uint8_t)crc ^ data[index]);
+    }
+
+    (*reg) = crc;
+}
+
+// Table of 65536 entries: the entry holds the remainder of two bytes, the first
+// byte is the high byte of the index for the forward and the low byte for the
+// reverse processing. The remainders of one byte are the entries with a zero
+// second byte.
+static inline __attribute__((always_inline)) void api_crc_processForwardWordOf(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const *const table = device->table;
+    uint8_t const shift = (sizeof(api_crc_register_t) - width) << 3U;
+    api_crc_register_t crc = (*reg);
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+
+    while(counter >= 2U)
+    {
+        crc = (crc << 16U) ^ (api_crc_readEntry(table, width, (uint16_t)(crc >> ((sizeof(api_crc_register_t) - 2U) << 3U)) ^ (((uint16_t)data[0U] << 8U) | data[1U])) << shift);
+        data += 2U;
+        counter -= 2U;
+    }
+
+    if(counter > 0U)
+    {
+        crc = (crc << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(crc >> ((sizeof(api_crc_register_t) - 1U) << 3U)) ^ (*data)) << shift);
+    }
+
+    (*reg) = crc;
+}
+
+static inline __attribute__((always_inline)) void api_crc_processReverseWordOf(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const *const table = device->table;
+    api_crc_register_t crc = (*reg);
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+
+    while(counter >= 2U)
+    {
+        crc = (crc >> 16U) ^ api_crc_readEntry(table, width, (uint16_t)crc ^ (((uint16_t)data[1U] << 8U) | data[0U]));
+        data += 2U;
+        counter -= 2U;
+    }
+
+    if(counter > 0U)
+    {
+        crc = (crc >> 8U) ^ api_crc_readEntry(table, width, (uint32_t)((uint8_t)crc ^ (*data)) << 8U);
+    }
+
+    (*reg) = crc;
+}
+
+// Slicing-by-8 / slicing-by-16: The table k holds the remainder of a byte
+// followed by k zero bytes, so that all bytes of one iteration are looked up
+// independently of each other. The register is never wider than one iteration.
+static inline __attribute__((always_inline)) void api_crc_processForwardSlicing(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const *const table = device->table;
+    uint32_t const slice = (256U * width) / sizeof(uint64_t);
+    uint32_t const slices = (device->tableType == API_CRC_TABLE_SLICING_BY_16) ? (16U) : (8U);
+    uint8_t const shift = (sizeof(api_crc_register_t) - width) << 3U;
+    api_crc_register_t crc = (*reg);
+    api_crc_register_t sum = 0U;
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+    uint32_t index = 0U;
+    uint8_t byte = 0U;
+
+    while(counter >= slices)
+    {
+        sum = 0U;
+
+        for(index = 0U; index < slices; index++)
+        {
+            byte = data[index];
+
+            if(index < sizeof(api_crc_register_t))
+            {
+                byte ^= (uint8_t)(crc >> ((sizeof(api_crc_register_t) - 1U - index) << 3U));
+            }
+
+            sum ^= api_crc_readEntry(&table[(slices - 1U - index) * slice], width, byte);
+        }
+
+        crc = sum << shift;
+        data += slices;
+        counter -= slices;
+    }
+
+    while(counter > 0U)
+    {
+        crc = (crc << 8U) ^ (api_crc_readEntry(table, width, (uint8_t)(crc >> ((sizeof(api_crc_register_t) - 1U) << 3U)) ^ (*data)) << shift);
+        data++;
+        counter--;
+    }
+
+    (*reg) = crc;
+}
+
+static inline __attribute__((always_inline)) void api_crc_processReverseSlicing(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const width, uint8_t const *const buffer, uint32_t const size)
+{
+    uint64_t const *const table = device->table;
+    uint32_t const slice = (256U * width) / sizeof(uint64_t);
+    uint32_t const slices = (device->tableType == API_CRC_TABLE_SLICING_BY_16) ? (16U) : (8U);
+    api_crc_register_t crc = (*reg);
+    api_crc_register_t sum = 0U;
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+    uint32_t index = 0U;
+    uint8_t byte = 0U;
+
+    while(counter >= slices)
+    {
+        sum = 0U;
+
+        for(index = 0U; index < slices; index++)
+        {
+            byte = data[index];
+
+            if(index < sizeof(api_crc_register_t))
+            {
+                byte ^= (uint8_t)(crc >> (index << 3U));
+            }
+
+            sum ^= api_crc_readEntry(&table[(slices - 1U - index) * slice], width, byte);
+        }
+
+        crc = sum;
+        data += slices;
+        counter -= slices;
+    }
+
+    while(counter > 0U)
+    {
+        crc = (crc >> 8U) ^ api_crc_readEntry(table, width, ((uint8_t)crc) ^ (*data));
+        data++;
+        counter--;
+    }
+
+    (*reg) = crc;
+}
+
+#ifdef API_CRC_CLMUL
+// Folding of a 128-bit block over the distance of the constants: both halves
+// are multiplied by x^distance (mod P) and summed up to a 128-bit remainder.
+static inline __attribute__((always_inline, target("pclmul,ssse3,sse4.1"))) __m128i api_crc_fold128(__m128i const block, __m128i const constants)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(block, constants, 0x00), _mm_clmulepi64_si128(block, constants, 0x11));
+}
+
+static inline __attribute__((always_inline, target("pclmul,ssse3,sse4.1"))) __m128i api_crc_load128(uint8_t const *const buffer, uint8_t const reverse)
+{
+    __m128i const block = _mm_loadu_si128((__m128i const *)buffer);
+
+    return (reverse) ? (block) : (_mm_shuffle_epi8(block, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)));
+}
+
+// Merges four consecutive 128-bit lanes into one, folds the remaining 128-bit
+// blocks of the data into it and reduces the result to the register with the
+// Barrett reduction. The register is a 64-bit CRC with the polynomial
+// x^(64-n) * P in both orders, left aligned for the forward and right aligned
+// for the reverse processing.
+static inline __attribute__((always_inline, target("pclmul,ssse3,sse4.1"))) api_crc_register_t api_crc_reduceCLMUL(api_crc_device_s const *const device, uint8_t const reverse, __m128i const *const lanes, uint8_t const **const data, uint32_t *const counter)
+{
+    __m128i const fold384 = _mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_384_LOW]);
+    __m128i const fold256 = _mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_256_LOW]);
+    __m128i const fold128 = _mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_128_LOW]);
+    __m128i const barrett = _mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_MU]);
+    __m128i block = _mm_xor_si128(_mm_xor_si128(api_crc_fold128(lanes[0U], fold384), api_crc_fold128(lanes[1U], fold256)), _mm_xor_si128(api_crc_fold128(lanes[2U], fold128), lanes[3U]));
+    __m128i quotient;
+    api_crc_register_t reg = 0U;
+
+    while((*counter) >= 16U)
+    {
+        block = _mm_xor_si128(api_crc_fold128(block, fold128), api_crc_load128((*data), reverse));
+        (*data) += 16U;
+        (*counter) -= 16U;
+    }
+
+    if(reverse)
+    {
+        // 128 -> 64 + 64 bits, the low half is the older one.
+        block = _mm_xor_si128(_mm_clmulepi64_si128(block, fold128, 0x10), _mm_srli_si128(block, 8));
+        // Barrett reduction in the reflected domain, the quotient is the low half of T * mu.
+        quotient = _mm_clmulepi64_si128(block, barrett, 0x00);
+        block = _mm_xor_si128(block, _mm_clmulepi64_si128(quotient, barrett, 0x10));
+        reg = (api_crc_register_t)_mm_extract_epi64(block, 1);
+        // The constant of the polynomial omits the term x^0 of P, it is added here.
+        reg ^= (device->polynomial >> 63U) ? ((api_crc_register_t)_mm_cvtsi128_si64(quotient)) : (0U);
+    }
+    else
+    {
+        // 128 -> 64 + 64 bits, the high half is the older one.
+        block = _mm_xor_si128(_mm_clmulepi64_si128(block, fold128, 0x01), _mm_slli_si128(block, 8));
+        // Barrett reduction, the quotient is the high half of T + T * mu.
+        quotient = _mm_xor_si128(_mm_srli_si128(_mm_clmulepi64_si128(block, barrett, 0x01), 8), _mm_srli_si128(block, 8));
+        block = _mm_xor_si128(block, _mm_clmulepi64_si128(quotient, barrett, 0x10));
+        reg = (api_crc_register_t)_mm_cvtsi128_si64(block);
+    }
+
+    return reg;
+}
+
+// Four independent 128-bit lanes are folded over 512 bits per iteration.
+static inline __attribute__((always_inline, target("pclmul,ssse3,sse4.1"))) uint32_t api_crc_processCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const reverse, uint8_t const *const buffer, uint32_t const size)
+{
+    __m128i const fold512 = _mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_512_LOW]);
+    __m128i lanes[4U];
+    uint8_t const *data = &buffer[64U];
+    uint32_t counter = size - 64U;
+    uint8_t index = 0U;
+
+    for(index = 0U; index < 4U; index++)
+    {
+        lanes[index] = api_crc_load128(&buffer[index << 4U], reverse);
+    }
+
+    lanes[0U] = _mm_xor_si128(lanes[0U], (reverse) ? (_mm_cvtsi64_si128((int64_t)(*reg))) : (_mm_set_epi64x((int64_t)(*reg), 0)));
+
+    while(counter >= 64U)
+    {
+        for(index = 0U; index < 4U; index++)
+        {
+            lanes[index] = _mm_xor_si128(api_crc_fold128(lanes[index], fold512), api_crc_load128(&data[index << 4U], reverse));
+        }
+
+        data += 64U;
+        counter -= 64U;
+    }
+
+    (*reg) = api_crc_reduceCLMUL(device, reverse, lanes, &data, &counter);
+
+    return size - counter;
+}
+
+// The segments of an I/O vector, or without a vector the rows of size bytes in
+// the distance of pitch bytes, are folded in the four lanes as one contiguous
+// data. A block of 64 bytes over a boundary of the segments is gathered in a
+// copy, the other blocks are folded in place. The rest of less than 16 bytes
+// after the last 128-bit block is copied to rest, its size is returned. The
+// segments hold at least 64 bytes together.
+static inline __attribute__((always_inline, target("pclmul,ssse3,sse4.1"))) uint8_t api_crc_processCLMULSegments(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const reverse, struct iovec const *const vector, uint8_t const *const buffer, uint64_t const size, uint64_t const pitch, uint32_t const count, uint8_t *const rest)
+{
+    __m128i const fold512 = _mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_512_LOW]);
+    __m128i lanes[4U] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+    uint8_t block[64U];
+    uint8_t const *unit = NULL;
+    uint8_t const *data = NULL;
+    uint64_t left = 0U;
+    uint64_t part = 0U;
+    uint32_t segment = 0U;
+    uint32_t counter = 0U;
+    uint8_t filled = 0U;
+    uint8_t started = 0U;
+    uint8_t index = 0U;
+
+#ifndef API_CRC_IOVEC
+    (void)vector;
+#endif // API_CRC_IOVEC
+
+    for(segment = 0U; segment < count; segment++)
+    {
+#ifdef API_CRC_IOVEC
+        data = (vector != NULL) ? ((uint8_t const *)vector[segment].iov_base) : (&buffer[segment * pitch]);
+        left = (vector != NULL) ? (vector[segment].iov_len) : (size);
+#else
+        data = &buffer[segment * pitch];
+        left = size;
+#endif // API_CRC_IOVEC
+
+        // the whole blocks of the segment in place
+        if((started) && (filled == 0U))
+        {
+            while(left >= 64U)
+            {
+                for(index = 0U; index < 4U; index++)
+                {
+                    lanes[index] = _mm_xor_si128(api_crc_fold128(lanes[index], fold512), api_crc_load128(&data[index << 4U], reverse));
+                }
+
+                data += 64U;
+                left -= 64U;
+            }
+        }
+
+        while(left > 0U)
+        {
+            if((filled == 0U) && (left >= 64U))
+            {
+                unit = data;
+                part = 64U;
+            }
+            else
+            {
+                part = ((uint64_t)(64U - filled) < left) ? ((uint64_t)(64U - filled)) : (left);
+                __builtin_memcpy(&block[filled], data, part);
+                filled += (uint8_t)part;
+                unit = block;
+            }
+
+            data += part;
+            left -= part;
+
+            if((filled == 0U) || (filled == 64U))
+            {
+                filled = 0U;
+
+                if(started)
+                {
+                    for(index = 0U; index < 4U; index++)
+                    {
+                        lanes[index] = _mm_xor_si128(api_crc_fold128(lanes[index], fold512), api_crc_load128(&unit[index << 4U], reverse));
+                    }
+                }
+                else
+                {
+                    for(index = 0U; index < 4U; index++)
+                    {
+                        lanes[index] = api_crc_load128(&unit[index << 4U], reverse);
+                    }
+
+                    lanes[0U] = _mm_xor_si128(lanes[0U], (reverse) ? (_mm_cvtsi64_si128((int64_t)(*reg))) : (_mm_set_epi64x((int64_t)(*reg), 0)));
+                    started = 1U;
+                }
+            }
+        }
+    }
+
+    data = block;
+    counter = filled;
+    (*reg) = api_crc_reduceCLMUL(device, reverse, lanes, &data, &counter);
+    __builtin_memcpy(rest, data, counter);
+
+    return (uint8_t)counter;
+}
+
+static inline __attribute__((always_inline, target(API_CRC_TARGET_VPCLMUL))) __m512i api_crc_fold512(__m512i const block, __m512i const constants, __m512i const data)
+{
+    return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(block, constants, 0x00), _mm512_clmulepi64_epi128(block, constants, 0x11), data, 0x96);
+}
+
+static inline __attribute__((always_inline, target(API_CRC_TARGET_VPCLMUL))) __m512i api_crc_load512(uint8_t const *const buffer, uint8_t const reverse)
+{
+    __m512i const block = _mm512_loadu_si512((void const *)buffer);
+
+    return (reverse) ? (block) : (_mm512_shuffle_epi8(block, _mm512_broadcast_i32x4(_mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15))));
+}
+
+// Four 512-bit registers of four 128-bit lanes each are folded over 2048 bits
+// per iteration, merged into one register and split into the four lanes of
+// the 128-bit folding.
+static inline __attribute__((always_inline, target(API_CRC_TARGET_VPCLMUL))) uint32_t api_crc_processVPCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const reverse, uint8_t const *const buffer, uint32_t const size)
+{
+    __m512i const fold2048 = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_2048_LOW]));
+    __m512i const fold1536 = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_1536_LOW]));
+    __m512i const fold1024 = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_1024_LOW]));
+    __m512i const fold512 = _mm512_broadcast_i32x4(_mm_loadu_si128((__m128i const *)&device->fold[API_CRC_FOLD_512_LOW]));
+    __m512i blocks[4U];
+    __m128i lanes[4U];
+    uint8_t const *data = &buffer[256U];
+    uint32_t counter = size - 256U;
+    uint8_t index = 0U;
+
+    for(index = 0U; index < 4U; index++)
+    {
+        blocks[index] = api_crc_load512(&buffer[index << 6U], reverse);
+    }
+
+    blocks[0U] = _mm512_xor_si512(blocks[0U], _mm512_zextsi128_si512((reverse) ? (_mm_cvtsi64_si128((int64_t)(*reg))) : (_mm_set_epi64x((int64_t)(*reg), 0))));
+
+    while(counter >= 256U)
+    {
+        for(index = 0U; index < 4U; index++)
+        {
+            blocks[index] = api_crc_fold512(blocks[index], fold2048, api_crc_load512(&data[index << 6U], reverse));
+        }
+
+        data += 256U;
+        counter -= 256U;
+    }
+
+    blocks[0U] = api_crc_fold512(blocks[0U], fold1536, api_crc_fold512(blocks[1U], fold1024, api_crc_fold512(blocks[2U], fold512, blocks[3U])));
+
+    while(counter >= 64U)
+    {
+        blocks[0U] = api_crc_fold512(blocks[0U], fold512, api_crc_load512(data, reverse));
+        data += 64U;
+        counter -= 64U;
+    }
+
+    lanes[0U] = _mm512_extracti32x4_epi32(blocks[0U], 0);
+    lanes[1U] = _mm512_extracti32x4_epi32(blocks[0U], 1);
+    lanes[2U] = _mm512_extracti32x4_epi32(blocks[0U], 2);
+    lanes[3U] = _mm512_extracti32x4_epi32(blocks[0U], 3);
+
+    (*reg) = api_crc_reduceCLMUL(device, reverse, lanes, &data, &counter);
+
+    return size - counter;
+}
+
+// Three independent streams of the CRC32 instruction hide its latency of three
+// cycles. The streams of the length L are merged as A * x^(16L) + B * x^(8L) + C,
+// the shift of a reflected 32-bit remainder by 8L bits is one carry-less product
+// with (x^(8L-33) mod P) followed by one CRC32 of the 64-bit product.
+static inline __attribute__((always_inline, target("sse4.2,pclmul"))) uint32_t api_crc_shiftCRC32C(uint32_t const crc, uint32_t const constant)
+{
+    return (uint32_t)_mm_crc32_u64(0U, (uint64_t)_mm_cvtsi128_si64(_mm_clmulepi64_si128(_mm_cvtsi32_si128((int32_t)crc), _mm_cvtsi32_si128((int32_t)constant), 0x00)));
+}
+
+static inline __attribute__((always_inline, target("sse4.2,pclmul"))) uint32_t api_crc_process3WayCRC32C(uint32_t const crc, uint8_t const **const data, uint32_t *const counter, uint32_t const length, uint32_t const shift1, uint32_t const shift2)
+{
+    uint64_t crcA = crc;
+    uint64_t crcB = 0U;
+    uint64_t crcC = 0U;
+    uint64_t word = 0U;
+    uint32_t index = 0U;
+    uint8_t const *block = (*data);
+
+    for(index = 0U; index < length; index += 8U)
+    {
+        __builtin_memcpy(&word, &block[index], sizeof(word));
+        crcA = _mm_crc32_u64(crcA, word);
+        __builtin_memcpy(&word, &block[length + index], sizeof(word));
+        crcB = _mm_crc32_u64(crcB, word);
+        __builtin_memcpy(&word, &block[(length << 1U) + index], sizeof(word));
+        crcC = _mm_crc32_u64(crcC, word);
+    }
+
+    (*data) += 3U * length;
+    (*counter) -= 3U * length;
+
+    return api_crc_shiftCRC32C((uint32_t)crcA, shift2) ^ api_crc_shiftCRC32C((uint32_t)crcB, shift1) ^ (uint32_t)crcC;
+}
+#endif // API_CRC_CLMUL
+
 void api_crc_processForwardBit(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint8_t const offset, uint32_t const size)
 {
     api_crc_register_t polynomial = 0;
@@ -148,25 +724,308 @@ void api_crc_processReverseBit(api_crc_device_s const *const device, api_crc_reg
     }
 }
 
-void api_crc_processForwardLUT(api_crc_device_s const *const device, api_crc_register_t *const reg, api_crc_register_t (*const api_crc_readTable)(uint64_t const *const, uint8_t const), uint8_t const *const buffer, uint32_t const size)
+void api_crc_processForwardLUT08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
 {
-    uint32_t counter = 0U;
+    api_crc_processForwardLUTOf(device, reg, sizeof(uint8_t), buffer, size);
+}
+
+void api_crc_processForwardLUT16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardLUTOf(device, reg, sizeof(uint16_t), buffer, size);
+}
+
+void api_crc_processForwardLUT32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardLUTOf(device, reg, sizeof(uint32_t), buffer, size);
+}
+
+#ifdef PLATFORM_X86_64
+void api_crc_processForwardLUT64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardLUTOf(device, reg, sizeof(uint64_t), buffer, size);
+}
+#endif
+
+void api_crc_processReverseLUT08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseLUTOf(device, reg, sizeof(uint8_t), buffer, size);
+}
 
-    for(counter = 0U; counter < size; counter++)
+void api_crc_processReverseLUT16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseLUTOf(device, reg, sizeof(uint16_t), buffer, size);
+}
+
+void api_crc_processReverseLUT32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseLUTOf(device, reg, sizeof(uint32_t), buffer, size);
+}
+
+#ifdef PLATFORM_X86_64
+void api_crc_processReverseLUT64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseLUTOf(device, reg, sizeof(uint64_t), buffer, size);
+}
+#endif
+
+void api_crc_processForwardNibble(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - __builtin_ctzll(device->polynomial);
+
+    if(order <= 8U)
     {
-        (*reg) = ((*reg) << (sizeof(buffer[0U]) << 3U)) ^ api_crc_readTable(device->table, ((*reg) >> ((sizeof(api_crc_register_t) - sizeof(buffer[0U])) << 3U)) ^ buffer[counter]);
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint8_t), buffer, size);
+    }
+    else if(order <= 16U)
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint16_t), buffer, size);
+    }
+    else if(order <= 32U)
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint32_t), buffer, size);
+    }
+    else
+    {
+        api_crc_processForwardNibbleOf(device, reg, sizeof(uint64_t), buffer, size);
     }
 }
 
-void api_crc_processReverseLUT(api_crc_device_s const *const device, api_crc_register_t *const reg, api_crc_register_t (*const api_crc_readTable)(uint64_t const *const, uint8_t const), uint8_t const *const buffer, uint32_t const size)
+void api_crc_processReverseNibble(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
 {
-    uint32_t counter = 0U;
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - __builtin_clzll(device->polynomial);
 
-    for(counter = 0U; counter < size; counter++)
+    if(order <= 8U)
     {
-        (*reg) = ((*reg) >> (sizeof(buffer[0U]) << 3U)) ^ api_crc_readTable(device->table, ((*reg) & 0xFFULL) ^ buffer[counter]);
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint8_t), buffer, size);
     }
+    else if(order <= 16U)
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint16_t), buffer, size);
+    }
+    else if(order <= 32U)
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint32_t), buffer, size);
+    }
+    else
+    {
+        api_crc_processReverseNibbleOf(device, reg, sizeof(uint64_t), buffer, size);
+    }
+}
+
+void api_crc_processForwardWord(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - __builtin_ctzll(device->polynomial);
+
+    if(order <= 8U)
+    {
+        api_crc_processForwardWordOf(device, reg, sizeof(uint8_t), buffer, size);
+    }
+    else if(order <= 16U)
+    {
+        api_crc_processForwardWordOf(device, reg, sizeof(uint16_t), buffer, size);
+    }
+    else if(order <= 32U)
+    {
+        api_crc_processForwardWordOf(device, reg, sizeof(uint32_t), buffer, size);
+    }
+    else
+    {
+        api_crc_processForwardWordOf(device, reg, sizeof(uint64_t), buffer, size);
+    }
+}
+
+void api_crc_processReverseWord(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint8_t const order = (sizeof(device->polynomial) << 3U) - __builtin_clzll(device->polynomial);
+
+    if(order <= 8U)
+    {
+        api_crc_processReverseWordOf(device, reg, sizeof(uint8_t), buffer, size);
+    }
+    else if(order <= 16U)
+    {
+        api_crc_processReverseWordOf(device, reg, sizeof(uint16_t), buffer, size);
+    }
+    else if(order <= 32U)
+    {
+        api_crc_processReverseWordOf(device, reg, sizeof(uint32_t), buffer, size);
+    }
+    else
+    {
+        api_crc_processReverseWordOf(device, reg, sizeof(uint64_t), buffer, size);
+    }
+}
+
+void api_crc_processForwardSlicing08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardSlicing(device, reg, sizeof(uint8_t), buffer, size);
+}
+
+void api_crc_processForwardSlicing16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardSlicing(device, reg, sizeof(uint16_t), buffer, size);
+}
+
+void api_crc_processForwardSlicing32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardSlicing(device, reg, sizeof(uint32_t), buffer, size);
+}
+
+#ifdef PLATFORM_X86_64
+void api_crc_processForwardSlicing64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processForwardSlicing(device, reg, sizeof(uint64_t), buffer, size);
+}
+#endif
+
+void api_crc_processReverseSlicing08(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseSlicing(device, reg, sizeof(uint8_t), buffer, size);
+}
+
+void api_crc_processReverseSlicing16(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseSlicing(device, reg, sizeof(uint16_t), buffer, size);
+}
+
+void api_crc_processReverseSlicing32(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseSlicing(device, reg, sizeof(uint32_t), buffer, size);
+}
+
+#ifdef PLATFORM_X86_64
+void api_crc_processReverseSlicing64(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    api_crc_processReverseSlicing(device, reg, sizeof(uint64_t), buffer, size);
+}
+#endif
+
+#ifdef API_CRC_CLMUL
+// The CPU is queried once when the library is loaded, before any thread of the
+// caller reads the engines. A single build of the library serves every host.
+__attribute__((constructor)) static void api_crc_queryEngines(void)
+{
+    uint8_t engines = (1U << API_CRC_ENGINE_TABLE);
+
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3") && __builtin_cpu_supports("sse4.1"))
+    {
+        engines |= (1U << API_CRC_ENGINE_CLMUL);
+
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+                && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("vpclmulqdq"))
+        {
+            engines |= (1U << API_CRC_ENGINE_VPCLMUL);
+        }
+    }
+
+    if(__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("pclmul"))
+    {
+        engines |= (1U << API_CRC_ENGINE_CRC32C);
+    }
+
+    __atomic_store_n(&api_crc_engines, (int8_t)engines, __ATOMIC_RELAXED);
+}
+
+uint8_t api_crc_supportedEngines(void)
+{
+    int8_t engines = __atomic_load_n(&api_crc_engines, __ATOMIC_RELAXED);
+
+    // a call from a constructor, which runs before api_crc_queryEngines; every
+    // thread stores the same value
+    if(engines < 0)
+    {
+        api_crc_queryEngines();
+        engines = __atomic_load_n(&api_crc_engines, __ATOMIC_RELAXED);
+    }
+
+    return (uint8_t)engines;
+}
+
+__attribute__((target("pclmul,ssse3,sse4.1"))) uint32_t api_crc_processForwardCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    return api_crc_processCLMUL(device, reg, 0U, buffer, size);
+}
+
+__attribute__((target("pclmul,ssse3,sse4.1"))) uint32_t api_crc_processReverseCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    return api_crc_processCLMUL(device, reg, 1U, buffer, size);
+}
+
+#ifdef API_CRC_IOVEC
+__attribute__((target("pclmul,ssse3,sse4.1"))) uint8_t api_crc_processForwardCLMULv(api_crc_device_s const *const device, api_crc_register_t *const reg, struct iovec const *const vector, uint32_t const count, uint8_t *const rest)
+{
+    return api_crc_processCLMULSegments(device, reg, 0U, vector, NULL, 0U, 0U, count, rest);
+}
+
+__attribute__((target("pclmul,ssse3,sse4.1"))) uint8_t api_crc_processReverseCLMULv(api_crc_device_s const *const device, api_crc_register_t *const reg, struct iovec const *const vector, uint32_t const count, uint8_t *const rest)
+{
+    return api_crc_processCLMULSegments(device, reg, 1U, vector, NULL, 0U, 0U, count, rest);
+}
+#endif // API_CRC_IOVEC
+
+__attribute__((target("pclmul,ssse3,sse4.1"))) uint8_t api_crc_processForwardCLMULStrided(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint64_t const size, uint64_t const pitch, uint32_t const rows, uint8_t *const rest)
+{
+    return api_crc_processCLMULSegments(device, reg, 0U, NULL, buffer, size, pitch, rows, rest);
+}
+
+__attribute__((target("pclmul,ssse3,sse4.1"))) uint8_t api_crc_processReverseCLMULStrided(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint64_t const size, uint64_t const pitch, uint32_t const rows, uint8_t *const rest)
+{
+    return api_crc_processCLMULSegments(device, reg, 1U, NULL, buffer, size, pitch, rows, rest);
+}
+
+__attribute__((target(API_CRC_TARGET_VPCLMUL))) uint32_t api_crc_processForwardVPCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    return api_crc_processVPCLMUL(device, reg, 0U, buffer, size);
+}
+
+__attribute__((target(API_CRC_TARGET_VPCLMUL))) uint32_t api_crc_processReverseVPCLMUL(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    return api_crc_processVPCLMUL(device, reg, 1U, buffer, size);
+}
+
+// The register of a reflected CRC-32C device is the register of the CRC32 instruction.
+__attribute__((target("sse4.2,pclmul"))) uint32_t api_crc_processCRC32C(api_crc_device_s const *const device, api_crc_register_t *const reg, uint8_t const *const buffer, uint32_t const size)
+{
+    uint32_t crc = (uint32_t)(*reg);
+    uint64_t word = 0U;
+    uint8_t const *data = buffer;
+    uint32_t counter = size;
+
+    (void)device;
+
+    // constants x^(8L-33) mod P and x^(16L-33) mod P, reflected
+    while(counter >= (3U * 1024U))
+    {
+        crc = api_crc_process3WayCRC32C(crc, &data, &counter, 1024U, 0x170076FAU, 0xA51B6135U);
+    }
+
+    while(counter >= (3U * 128U))
+    {
+        crc = api_crc_process3WayCRC32C(crc, &data, &counter, 128U, 0x0D3B6092U, 0xB9E02B86U);
+    }
+
+    while(counter >= 8U)
+    {
+        __builtin_memcpy(&word, data, sizeof(word));
+        crc = (uint32_t)_mm_crc32_u64(crc, word);
+        data += 8U;
+        counter -= 8U;
+    }
+
+    while(counter > 0U)
+    {
+        crc = _mm_crc32_u8(crc, (*data));
+        data++;
+        counter--;
+    }
+
+    (*reg) = crc;
+
+    return size;
 }
+#endif // API_CRC_CLMUL
 
 //------------------------------------------------------------------------------
 //!
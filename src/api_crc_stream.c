@@ -0,0 +1,458 @@
+//------------------------------------------------------------------------------
+//  Home Office
+//  Nürnberg, Germany
+//  E-Mail: sergej1@email.ua
+//
+//  Copyright (C) 2021 free Project CRC Generic library. All rights reserved.
+//------------------------------------------------------------------------------
+//  The CRC Generic library is designed as a universal solution for most practical
+//  CRC methods and provides a flexible API for communication application developers
+//------------------------------------------------------------------------------
+//!
+//! \cond COND_API
+//! \cond COND_API_LIBRARY
+//! \cond COND_API_LIBRARY_CRC
+//! \cond COND_API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \addtogroup API_LIBRARY_CRC_INTERFACE
+//! \{
+//!
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Includes
+//------------------------------------------------------------------------------
+
+#include "../inc/api_crc_stream.h"
+#include "../cfg/api_crc_cfg.h"
+#include "api_crc_private.h"
+
+//------------------------------------------------------------------------------
+// Preprocessor
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Enums
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Function Prototypes
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Data
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Public Data
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// Private Functions
+//------------------------------------------------------------------------------
+
+// Byte of the first count positions of the input order, positions count from the least significant bit of a
+// reverse and from the most significant bit of a forward device.
+static uint8_t api_crc_streamMask(uint8_t const count, uint8_t const reverse)
+{
+    if(reverse != 0U)
+    {
+        return (uint8_t)((1U << count) - 1U);
+    }
+
+    return (uint8_t)(0xFF00U >> count);
+}
+
+// Count bits of the buffer from the bit position on, in the first positions of the byte. The byte after the
+// position is read only if the bits reach into it.
+static uint8_t api_crc_streamBits(uint8_t const *const buffer, uint64_t const position, uint8_t const count, uint8_t const reverse)
+{
+    uint8_t const *const data = &buffer[position >> 3U];
+    uint8_t const shift = position & 7U;
+    uint16_t bits = 0U;
+
+    if(reverse != 0U)
+    {
+        bits = data[0U] >> shift;
+        bits |= ((shift + count) > 8U) ? ((uint16_t)(data[1U] << (8U - shift))) : (0U);
+    }
+    else
+    {
+        bits = (uint8_t)(data[0U] << shift);
+        bits |= ((shift + count) > 8U) ? ((uint16_t)(data[1U] >> (8U - shift))) : (0U);
+    }
+
+    return (uint8_t)bits & api_crc_streamMask(count, reverse);
+}
+
+// Bytes of the stream from an unaligned bit position, each byte of the block is put together from two
+// neighbouring bytes of the buffer, eight at a time from two overlapping words of a little-endian CPU.
+static void api_crc_streamRealign(uint8_t *const block, uint8_t const *const buffer, uint64_t const position, uint32_t const bytes, uint8_t const reverse)
+{
+    uint8_t const *const data = &buffer[position >> 3U];
+    uint8_t const shift = position & 7U;
+    uint64_t word = 0U;
+    uint64_t next = 0U;
+    uint32_t index = 0U;
+
+    for(index = 0U; (index + 8U) <= bytes; index += 8U)
+    {
+        __builtin_memcpy(&word, &data[index], sizeof(word));
+        __builtin_memcpy(&next, &data[index + 1U], sizeof(next));
+
+        if(reverse != 0U)
+        {
+            word = (word >> shift) | (next << (8U - shift));
+        }
+        else
+        {
+            word = __builtin_bswap64((__builtin_bswap64(word) << shift) | (__builtin_bswap64(next) >> (8U - shift)));
+        }
+
+        __builtin_memcpy(&block[index], &word, sizeof(word));
+    }
+
+    for(; index < bytes; index++)
+    {
+        block[index] = (reverse != 0U) ? ((uint8_t)((data[index] >> shift) | (data[index + 1U] << (8U - shift))))
+                       : ((uint8_t)((data[index] << shift) | (data[index + 1U] >> (8U - shift))));
+    }
+}
+
+//------------------------------------------------------------------------------
+// Public Functions
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function prepares a cursor for the CRC of a bit stream, which is
+//! delivered in chunks starting and ending at any bit.
+//!
+//! \details
+//! The state register of the cursor is reset by ::api_crc_reset, no bits are
+//! pending. The table of the cursor holds the register after one byte from zero,
+//! it processes the short chunks without the dispatch of ::api_crc_process.
+//!
+//! \param[in] *device ::api_crc_device_s Specification of Cyclic Redundancy Code for given parameters.
+//!
+//! \param[out] *cursor ::api_crc_cursor_s The cursor for ::api_crc_cursorProcess.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//! \retval ::API_CRC_STATUS_NOT_SUPPORTED
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_cursorInit"];
+//!
+//! CALLER=>FU[label = "api_crc_cursorInit(device, cursor)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_NOT_SUPPORTED", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! api_crc_cursor_s cursor;
+//! api_crc_status_e status = api_crc_cursorInit(&device, &cursor);
+//! if (status != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_init is called before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! The cursor keeps a pointer to the device, which must outlive the cursor.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_cursorInit(api_crc_device_s const *const device, api_crc_cursor_s *const cursor)
+{
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t state = 0U;
+    uint8_t byte = 0U;
+    uint16_t index = 0U;
+
+    if((device == NULL) || (cursor == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    for(index = 0U; index < 256U; index++)
+    {
+        byte = (uint8_t)index;
+        state = 0U;
+        if((status = api_crc_process(device, &state, &byte, 0U, 8U)) != API_CRC_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        cursor->table[index] = api_crc_stateRegister(device, state);
+    }
+
+    if((status = api_crc_reset(device, &cursor->state)) != API_CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    cursor->device = device;
+    cursor->pending = 0U;
+    cursor->count = 0U;
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function continues the CRC of the stream with the next chunk of bits.
+//!
+//! \details
+//! The bits of the stream after its last whole byte are kept pending in the cursor
+//! instead of running through the bit-serial loop of ::api_crc_process. The chunk
+//! completes the pending byte first, the last bits of the chunk become the new
+//! pending bits. Less than 64 whole bytes in between are processed by the table of
+//! the cursor. More are processed by the table, slicing or CLMUL engine of the
+//! device: directly from the buffer, if the chunk continues the stream in the same
+//! bit position of a byte as the pending bits, as in a stream split by a decoder,
+//! otherwise realigned in blocks of 1 KB.
+//!
+//! \param[in,out] *cursor ::api_crc_cursor_s The cursor of ::api_crc_cursorInit.
+//!
+//! \param[in] *buffer The data of the chunk.
+//!
+//! \param[in] offset The offset of the first bit in the first byte of the buffer, 0 to 7.
+//!
+//! \param[in] size The number of bits of the chunk.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_cursorProcess"];
+//!
+//! CALLER=>FU[label = "api_crc_cursorProcess(cursor, buffer, offset, size)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! // 13 bits of the frame, then the following 100 bits
+//! if ((api_crc_cursorProcess(&cursor, frame, 0U, 13U) != API_CRC_STATUS_SUCCESS)
+//!         || (api_crc_cursorProcess(&cursor, &frame[1U], 5U, 100U) != API_CRC_STATUS_SUCCESS))
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_cursorInit is called before.
+//!
+//! \post
+//! The function ::api_crc_cursorFinalize returns the CRC value of the stream.
+//!
+//! \note
+//! In the case of an error the cursor is not changed.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_cursorProcess(api_crc_cursor_s *const cursor, uint8_t const *const buffer, uint8_t const offset, uint32_t const size)
+{
+    api_crc_register_t reg = 0U;
+    uint8_t block[API_CRC_STREAM_BLOCK_SIZE];
+    uint64_t position = offset;
+    uint64_t const end = (uint64_t)offset + size;
+    uint32_t bytes = 0U;
+    uint8_t take = 0U;
+    uint8_t reverse = 0U;
+
+    if((cursor == NULL) || (cursor->device == NULL) || (buffer == NULL) || (offset >= 8U)
+            || (((uint64_t)((void *)((uint64_t)buffer + ((end + 7ULL) >> 3U)))) < (uint64_t)buffer))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    reverse = (cursor->device->inputOrder == API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT);
+    reg = api_crc_stateRegister(cursor->device, cursor->state);
+
+    // completion of the pending byte
+    if(cursor->count != 0U)
+    {
+        take = ((8U - cursor->count) < size) ? (8U - cursor->count) : ((uint8_t)size);
+        cursor->pending |= (reverse != 0U) ? ((uint8_t)(api_crc_streamBits(buffer, position, take, reverse) << cursor->count))
+                           : (api_crc_streamBits(buffer, position, take, reverse) >> cursor->count);
+        cursor->count += take;
+        position += take;
+
+        if(cursor->count == 8U)
+        {
+            reg = api_crc_processByteOf(cursor->table, reg, cursor->pending, sizeof(api_crc_register_t), reverse);
+            cursor->pending = 0U;
+            cursor->count = 0U;
+        }
+    }
+
+    bytes = (uint32_t)((end - position) >> 3U);
+
+    if(bytes < API_CRC_STREAM_SHORT_SIZE)
+    {
+        for(; bytes > 0U; bytes--)
+        {
+            reg = api_crc_processByteOf(cursor->table, reg, ((position & 7U) == 0U) ? (buffer[position >> 3U]) : (api_crc_streamBits(buffer, position, 8U, reverse)),
+                                        sizeof(api_crc_register_t), reverse);
+            position += 8U;
+        }
+
+        cursor->state = api_crc_registerState(cursor->device, reg);
+    }
+    else if((position & 7U) == 0U)
+    {
+        cursor->state = api_crc_registerState(cursor->device, reg);
+        api_crc_process(cursor->device, &cursor->state, &buffer[position >> 3U], 0U, bytes << 3U);
+        position += (uint64_t)bytes << 3U;
+    }
+    else
+    {
+        cursor->state = api_crc_registerState(cursor->device, reg);
+        while((end - position) >= 8U)
+        {
+            bytes = (((end - position) >> 3U) < API_CRC_STREAM_BLOCK_SIZE) ? ((uint32_t)((end - position) >> 3U)) : (API_CRC_STREAM_BLOCK_SIZE);
+            api_crc_streamRealign(block, buffer, position, bytes, reverse);
+            api_crc_process(cursor->device, &cursor->state, block, 0U, bytes << 3U);
+            position += (uint64_t)bytes << 3U;
+        }
+    }
+
+    // the last bits of the chunk, nothing is pending here
+    if(position < end)
+    {
+        cursor->count = (uint8_t)(end - position);
+        cursor->pending = api_crc_streamBits(buffer, position, cursor->count, reverse);
+    }
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! This function returns the CRC value of the stream up to now.
+//!
+//! \details
+//! The pending bits are processed by ::api_crc_process into a copy of the state
+//! register, which is finalized by ::api_crc_finalize. The cursor is not changed,
+//! the stream can be continued after an intermediate CRC value.
+//!
+//! \param[in] *cursor ::api_crc_cursor_s The cursor of ::api_crc_cursorInit.
+//!
+//! \param[out] *state ::api_crc_state_t The CRC value of the stream.
+//!
+//! \retval ::API_CRC_STATUS_SUCCESS
+//! \retval ::API_CRC_STATUS_INVALID_PARAMETER
+//!
+//! \par Message Sequence Chart
+//!
+//! \msc
+//! hscale = "1", arcgradient = "8";
+//!
+//! CALLER[label = "Caller"], FU[label = "api_crc_cursorFinalize"];
+//!
+//! CALLER=>FU[label = "api_crc_cursorFinalize(cursor, state)"];
+//!
+//! FU>>CALLER[label = "return API_CRC_STATUS_SUCCESS", linecolor = "#379B7A"];
+//! FU>>CALLER[label = "return API_CRC_STATUS_INVALID_PARAMETER", linecolor = "#FF0000"];
+//! \endmsc
+//!
+//! \par Example
+//! \code{.cpp}
+//! api_crc_state_t state = 0U;
+//! if (api_crc_cursorFinalize(&cursor, &state) != API_CRC_STATUS_SUCCESS)
+//! {
+//!    // Error handling...
+//!    return 1;
+//! }
+//! \endcode
+//!
+//! \pre
+//! The function ::api_crc_cursorInit is called before.
+//!
+//! \post
+//! Nothing.
+//!
+//! \note
+//! Nothing.
+//!
+//! \warning
+//! Nothing.
+//!
+//------------------------------------------------------------------------------
+api_crc_status_e api_crc_cursorFinalize(api_crc_cursor_s const *const cursor, api_crc_state_t *const state)
+{
+    api_crc_status_e status = API_CRC_STATUS_SUCCESS;
+    api_crc_state_t copy = 0U;
+
+    if((cursor == NULL) || (cursor->device == NULL) || (state == NULL))
+    {
+        return API_CRC_STATUS_INVALID_PARAMETER;
+    }
+
+    copy = cursor->state;
+    if((status = api_crc_process(cursor->device, &copy, &cursor->pending, 0U, cursor->count)) != API_CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if((status = api_crc_finalize(cursor->device, &copy)) != API_CRC_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    (*state) = copy;
+
+    return API_CRC_STATUS_SUCCESS;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \} // API_LIBRARY_CRC_INTERFACE
+//!
+//------------------------------------------------------------------------------
+//!
+//! \endcond // COND_API_LIBRARY_CRC_INTERFACE
+//! \endcond // COND_API_LIBRARY_CRC
+//! \endcond // COND_API_LIBRARY
+//! \endcond // COND_API
+//!
+//------------------------------------------------------------------------------
@@ -50,6 +50,9 @@
 //------------------------------------------------------------------------------
 
 #include "../inc/api_crc.h"
+#include "../inc/api_crc_poly.h"
+#include "../inc/api_crc_chunk.h"
+#include "../inc/api_crc_stream.h"
 
 #include <stdio.h>
 
@@ -62,6 +65,8 @@
 
 int crc_processing(api_crc_device_s const *const device, api_crc_state_t *const state, uint8_t const *const buffer, uint8_t const offset, uint32_t const buffer_size);
 void output_Check(const uint64_t crc_Value, api_crc_state_t *const state);
+double crc_throughput(api_crc_device_s const *const device, uint8_t const *const buffer, uint32_t const buffer_size, uint8_t *const evict, uint32_t const evict_size);
+double chunk_throughput(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t const buffer_size, uint32_t *const chunks);
 
 //------------------------------------------------------------------------------
 //!
@@ -113,10 +118,16 @@ int main(void)
         outputXOR,
         0U,
         inputOrder,
-        outputOrder
+        outputOrder,
+        API_CRC_TABLE_BYTE,
+#if (API_CRC_FOLD_SIZE > 0U)
+        {0U}
+#endif // API_CRC_FOLD_SIZE
     };
     api_crc_state_t state = 0U;
     uint64_t table[256] = {0U};
+    uint32_t n = 0U;
+    uint32_t table_size = 0U;
     uint8_t offset = 0U;
 //    uint8_t *buffer = 0U;
     uint32_t buffer_size = 0U;
@@ -164,6 +175,7 @@ int main(void)
             & (api_crc_table(0U, (uint64_t*) table, size) == API_CRC_STATUS_INVALID_PARAMETER)
             & (api_crc_table(&device, 0U, size) == API_CRC_STATUS_INVALID_PARAMETER)
             & (api_crc_table(&device, (uint64_t*) table, 1024) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_table(&device, (uint64_t*) table, size << 3U) == API_CRC_STATUS_INVALID_PARAMETER)
         )
      {
          printf("Status of api_crc_table(device, table, size) is Ok\n\n\n");
@@ -255,6 +267,429 @@ int main(void)
         printf("Status of api_crc_finalize(&device, &state) is not Ok\n\n\n");
     }
 
+    //------------------------------------------------------------------------------
+    // Test Case 1.7.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.7.                                                             */\n");
+    printf("/* The review for the functions api_crc_getEngine() and api_crc_setEngine()   */\n");
+    printf("/******************************************************************************/\n");
+    printf("Engine of the CPU = %d\n", api_crc_getEngine());
+    if ((api_crc_setEngine(API_CRC_ENGINE_TABLE) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_getEngine() == API_CRC_ENGINE_TABLE)
+            & (api_crc_setEngine((api_crc_engine_e)(API_CRC_ENGINE_CRC32C + 1)) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_getEngine() == API_CRC_ENGINE_TABLE)
+            & (api_crc_setEngine(API_CRC_ENGINE_AUTO) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_getEngine() != API_CRC_ENGINE_AUTO)
+       )
+    {
+        printf("Status of api_crc_getEngine() and api_crc_setEngine(engine) is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_getEngine() and api_crc_setEngine(engine) is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.8.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.8.                                                             */\n");
+    printf("/* The review for the function api_crc_combine(device, stateA, stateB, size)  */\n");
+    printf("/******************************************************************************/\n");
+    if ((api_crc_combine(&device, &state, state, 8U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_combine(0U, &state, state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_combine(&device, 0U, state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_combine(device, stateA, stateB, size) is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_combine(device, stateA, stateB, size) is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.9.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.9.                                                             */\n");
+    printf("/* The review for the functions api_crc_processZeros and processConstant      */\n");
+    printf("/******************************************************************************/\n");
+    if ((api_crc_processZeros(&device, &state, 8U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processZeros(0U, &state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processZeros(&device, 0U, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processConstant(&device, &state, 0x31, 1U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processConstant(0U, &state, 0x31, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processConstant(&device, 0U, 0x31, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_processZeros and api_crc_processConstant is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_processZeros and api_crc_processConstant is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.10.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.10.                                                            */\n");
+    printf("/* Review for api_crc_patch(device, state, offset, old, new, size, length)    */\n");
+    printf("/******************************************************************************/\n");
+    if ((api_crc_patch(&device, &state, 0U, bufferTest, bufferTest, 1U, 1U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_patch(0U, &state, 0U, bufferTest, bufferTest, 1U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_patch(&device, 0U, 0U, bufferTest, bufferTest, 1U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_patch(&device, &state, 0U, 0U, bufferTest, 1U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_patch(&device, &state, 0U, bufferTest, 0U, 1U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_patch(&device, &state, 1U, bufferTest, bufferTest, 1U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_patch(device, state, offset, old, new, size, length) is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_patch(device, state, offset, old, new, size, length) is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.11.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.11.                                                            */\n");
+    printf("/* The review for the functions api_crc_removePrefix and removeSuffix         */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_device_s deviceNone = API_CRC_INIT(0U, 0U, 0U, 0U, 0U, 0U);
+    if ((api_crc_removePrefix(&device, &state, state, 8U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_removePrefix(0U, &state, state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_removePrefix(&device, 0U, state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_removeSuffix(&device, &state, state, 8U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_removeSuffix(0U, &state, state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_removeSuffix(&device, 0U, state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_removeSuffix(&deviceNone, &state, state, 8U) == API_CRC_STATUS_NOT_SUPPORTED)
+       )
+    {
+        printf("Status of api_crc_removePrefix and api_crc_removeSuffix is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_removePrefix and api_crc_removeSuffix is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.12.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.12.                                                            */\n");
+    printf("/* The review for the function api_crc_derive(device, state, size)            */\n");
+    printf("/******************************************************************************/\n");
+    if ((api_crc_derive(&device, &state, 8U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_derive(0U, &state, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_derive(&device, 0U, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_derive(device, state, size) is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_derive(device, state, size) is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.13.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.13.                                                            */\n");
+    printf("/* The review for the polynomial algebra api_crc_poly*                        */\n");
+    printf("/******************************************************************************/\n");
+    uint64_t factors[API_CRC_POLY_FACTORS];
+    uint64_t value = 0U;
+    uint8_t count = 0U;
+    if ((api_crc_polyMultiply(0x1U, 0x4001U, &value) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyMultiply(0x1U, 0x4001U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyMultiply(0x8000000000000000ULL, 0x1U, &value) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyGcd(0xC002U, 0x8810U, &value) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyGcd(0xC002U, 0x8810U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyMod(0x31U, 0xC002U, &value) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyMod(0x31U, 0U, &value) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyMod(0x31U, 0xC002U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyMultiplyMod(0x31U, 0x31U, 0xC002U, &value) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyMultiplyMod(0x31U, 0x31U, 0U, &value) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyMultiplyMod(0x31U, 0x31U, 0xC002U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyPowerMod(0x2U, 8U, 0xC002U, &value) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyPowerMod(0x2U, 8U, 0U, &value) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyPowerMod(0x2U, 8U, 0xC002U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyFactor(0xC002U, factors, &count) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyFactor(0U, factors, &count) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyFactor(0xC002U, 0U, &count) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyFactor(0xC002U, factors, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyPeriod(0xC002U, &value) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyPeriod(0U, &value) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyPeriod(0xC002U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyIsIrreducible(0xC002U, &count) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyIsIrreducible(0U, &count) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyIsIrreducible(0xC002U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyIsPrimitive(0xC002U, &count) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_polyIsPrimitive(0U, &count) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_polyIsPrimitive(0xC002U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of the polynomial algebra api_crc_poly* is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of the polynomial algebra api_crc_poly* is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.14.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.14.                                                            */\n");
+    printf("/* The review for the functions api_crc_rollTable and api_crc_roll            */\n");
+    printf("/******************************************************************************/\n");
+    uint64_t tableRoll[256U];
+    if ((api_crc_rollTable(&device, tableRoll, api_crc_sizeofTable(polynomial), 16U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_rollTable(0U, tableRoll, api_crc_sizeofTable(polynomial), 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_rollTable(&device, 0U, api_crc_sizeofTable(polynomial), 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_rollTable(&device, tableRoll, 1U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_roll(&device, tableRoll, &state, 0x30, 0x31) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_roll(0U, tableRoll, &state, 0x30, 0x31) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_roll(&device, 0U, &state, 0x30, 0x31) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_roll(&device, tableRoll, 0U, 0x30, 0x31) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_rollTable and api_crc_roll is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_rollTable and api_crc_roll is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.15.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.15.                                                            */\n");
+    printf("/* The review for the functions api_crc_chunkerInit and api_crc_chunk         */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_chunker_s chunker;
+    uint32_t length = 0U;
+    api_crc_chunkerInit(&device, 64U, 256U, 1024U, 16U, &chunker);
+    api_crc_chunk(&chunker, (uint8_t const *) table, sizeof(table), &length, &state);
+    if ((length >= 64U) & (length <= 1024U)
+            & (api_crc_chunkerInit(&device, 64U, 256U, 1024U, 16U, &chunker) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_chunkerInit(0U, 64U, 256U, 1024U, 16U, &chunker) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 64U, 256U, 1024U, 16U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 64U, 256U, 1024U, 0U, &chunker) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 16U, 256U, 1024U, 16U, &chunker) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 64U, 32U, 1024U, 16U, &chunker) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 64U, 256U, 128U, 16U, &chunker) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 64U, 65536U, 65536U, 16U, &chunker) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunkerInit(&device, 64U, 256U, 1024U, 16U, &chunker) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_chunk(&chunker, (uint8_t const *) table, sizeof(table), &length, &state) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_chunk(0U, (uint8_t const *) table, sizeof(table), &length, &state) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunk(&chunker, 0U, sizeof(table), &length, &state) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunk(&chunker, (uint8_t const *) table, 0U, &length, &state) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunk(&chunker, (uint8_t const *) table, sizeof(table), 0U, &state) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_chunk(&chunker, (uint8_t const *) table, sizeof(table), &length, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_chunkerInit and api_crc_chunk is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_chunkerInit and api_crc_chunk is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.16.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.16.                                                            */\n");
+    printf("/* The review for the function api_crc_processMulti                           */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_device_s const *devices[2U] = {&device, &device};
+    api_crc_device_s const *devicesNone[2U] = {&device, 0U};
+    api_crc_state_t states[2U] = {0U, 0U};
+    if ((api_crc_processMulti(devices, states, 2U, (uint8_t const *) table, offset, 8U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processMulti(0U, states, 2U, (uint8_t const *) table, offset, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processMulti(devices, 0U, 2U, (uint8_t const *) table, offset, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processMulti(devices, states, 0U, (uint8_t const *) table, offset, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processMulti(devices, states, 2U, 0U, offset, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processMulti(devices, states, 2U, (uint8_t const *) table, 8U, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processMulti(devicesNone, states, 2U, (uint8_t const *) table, offset, 8U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_processMulti is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_processMulti is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.17.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.17.                                                            */\n");
+    printf("/* The review for the functions api_crc_cursorInit, api_crc_cursorProcess and */\n");
+    printf("/* api_crc_cursorFinalize                                                     */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_cursor_s cursor;
+    api_crc_cursorInit(&device, &cursor);
+    if ((api_crc_cursorInit(&device, &cursor) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_cursorInit(0U, &cursor) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_cursorInit(&device, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_cursorProcess(&cursor, (uint8_t const *) table, offset, 13U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_cursorProcess(0U, (uint8_t const *) table, offset, 13U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_cursorProcess(&cursor, 0U, offset, 13U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_cursorProcess(&cursor, (uint8_t const *) table, 8U, 13U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_cursorFinalize(&cursor, &state) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_cursorFinalize(0U, &state) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_cursorFinalize(&cursor, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_cursorInit, api_crc_cursorProcess and api_crc_cursorFinalize is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_cursorInit, api_crc_cursorProcess and api_crc_cursorFinalize is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.18.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.18.                                                            */\n");
+    printf("/* The review for the function api_crc_processParallel                        */\n");
+    printf("/******************************************************************************/\n");
+    if ((api_crc_processParallel(&device, &state, (uint8_t const *) table, offset, 1024U, 2U, 16U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processParallel(0U, &state, (uint8_t const *) table, offset, 1024U, 2U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processParallel(&device, 0U, (uint8_t const *) table, offset, 1024U, 2U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processParallel(&device, &state, 0U, offset, 1024U, 2U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processParallel(&device, &state, (uint8_t const *) table, 8U, 1024U, 2U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processParallel(&device, &state, (uint8_t const *) table, offset, 1024U, 0U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processParallel(&device, &state, (uint8_t const *) table, offset, 1024U, API_CRC_PARALLEL_THREADS + 1U, 16U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processParallel(&device, &state, (uint8_t const *) table, offset, 1024U, 2U, 0U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_processParallel is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_processParallel is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.19.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.19.                                                            */\n");
+    printf("/* The review for the function api_crc_processBatch                           */\n");
+    printf("/******************************************************************************/\n");
+    uint8_t const *batchBuffers[2U] = {(uint8_t const *) table, 0U};
+    uint32_t batchSizes[2U] = {16U, 0x20000000U};
+    api_crc_state_t batchStates[2U];
+
+    if ((api_crc_processBatch(&device, batchBuffers, batchSizes, batchStates, 1U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processBatch(&device, batchBuffers, batchSizes, batchStates, 0U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processBatch(0U, batchBuffers, batchSizes, batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatch(&device, 0U, batchSizes, batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatch(&device, batchBuffers, 0U, batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatch(&device, batchBuffers, batchSizes, 0U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatch(&device, batchBuffers, batchSizes, batchStates, 2U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatch(&device, batchBuffers, &batchSizes[1U], batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_processBatch is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_processBatch is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.20.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.20.                                                            */\n");
+    printf("/* The review for the function api_crc_processBatchBits                       */\n");
+    printf("/******************************************************************************/\n");
+    batchSizes[0U] = 11U;
+
+    if ((api_crc_processBatchBits(&device, batchBuffers, batchSizes, batchStates, 1U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processBatchBits(&device, batchBuffers, batchSizes, batchStates, 0U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processBatchBits(0U, batchBuffers, batchSizes, batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatchBits(&device, 0U, batchSizes, batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatchBits(&device, batchBuffers, 0U, batchStates, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatchBits(&device, batchBuffers, batchSizes, 0U, 1U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processBatchBits(&device, batchBuffers, batchSizes, batchStates, 2U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_processBatchBits is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_processBatchBits is not Ok\n\n\n");
+    }
+
+#ifdef API_CRC_IOVEC
+    //------------------------------------------------------------------------------
+    // Test Case 1.21.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.21.                                                            */\n");
+    printf("/* The review for the function api_crc_processv                               */\n");
+    printf("/******************************************************************************/\n");
+    struct iovec vectorSegments[2U] = {{(void *) table, 16U}, {0U, 0U}};
+
+    if ((api_crc_processv(&device, batchStates, vectorSegments, 2U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processv(&device, batchStates, vectorSegments, 0U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processv(0U, batchStates, vectorSegments, 2U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processv(&device, 0U, vectorSegments, 2U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processv(&device, batchStates, 0U, 2U) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        vectorSegments[1U].iov_len = 1U;
+        if (api_crc_processv(&device, batchStates, vectorSegments, 2U) == API_CRC_STATUS_INVALID_PARAMETER)
+        {
+            printf("Status of api_crc_processv is Ok\n\n\n");
+        }
+        else
+        {
+            printf("Status of api_crc_processv is not Ok\n\n\n");
+        }
+    }
+    else
+    {
+        printf("Status of api_crc_processv is not Ok\n\n\n");
+    }
+#endif // API_CRC_IOVEC
+
+    //------------------------------------------------------------------------------
+    // Test Case 1.22.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 1.22.                                                            */\n");
+    printf("/* The review for the function api_crc_processStrided                         */\n");
+    printf("/******************************************************************************/\n");
+    if ((api_crc_processStrided(&device, batchStates, (uint8_t const *) table, 16U, 64U, 4U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processStrided(&device, batchStates, (uint8_t const *) table, 16U, 64U, 0U) == API_CRC_STATUS_SUCCESS)
+            & (api_crc_processStrided(0U, batchStates, (uint8_t const *) table, 16U, 64U, 4U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processStrided(&device, 0U, (uint8_t const *) table, 16U, 64U, 4U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processStrided(&device, batchStates, 0U, 16U, 64U, 4U) == API_CRC_STATUS_INVALID_PARAMETER)
+            & (api_crc_processStrided(&device, batchStates, (uint8_t const *) table, 16U, 0xFFFFFFFFU, 0xFFFFFFFFU) == API_CRC_STATUS_INVALID_PARAMETER)
+       )
+    {
+        printf("Status of api_crc_processStrided is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_processStrided is not Ok\n\n\n");
+    }
+
     //------------------------------------------------------------------------------
     // Block 2.
     //------------------------------------------------------------------------------
@@ -563,34 +998,26 @@ int main(void)
     output_Check(crc_Value, &state);
 
     //------------------------------------------------------------------------------
-    // Block 3.
-    //------------------------------------------------------------------------------
-    uint32_t n, N = 1966080U;
-    uint8_t ARR[N];
-
-    for (n = 0U; n < N; n++)
-    {
-		ARR[n] = 0x30 + n%10;
-	}
-
-//    printf("Value of array[] in bytes %d\n", n);
-    buffer_size = (n << 3);
-    clock_t clockStart, clockEnd;
-    double clockElapsedSeconds;
-
-    //------------------------------------------------------------------------------
-    // Test Case 3.1.
+    // Test Case 2.8.
     //------------------------------------------------------------------------------
     printf("/******************************************************************************/\n");
-    printf("/* Test Case 3.1.                                                             */\n");
-    printf("/* Performance Test for CRC-32 Forward LFSR                                   */\n");
+    printf("/* Test Case 2.8.                                                             */\n");
+    printf("/* ### Slicing-by-8 : CRC32 ###                                               */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* outputXOR:            0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* Bits Order:           MSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (5x)    */\n");
+    printf("/* CRC32:           0x24a56cf5                                                */\n");
     printf("/******************************************************************************/\n");
     polynomial = 0x82608EDB;
-    inputXOR = 0xFFFFFFFF;
-    outputXOR = 0x00000000;
+    inputXOR = 0x00;
+    outputXOR = 0x00;
     inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
     outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
-    crc_Value = 0x57b403d1;
+    buffer_size = (sizeof(bufferCRC32)/sizeof(uint8_t))*8;
+    crc_Value = 0x24a56cf5;
+    uint32_t tableSlicing[16][256] = {{0U}};
 
     // init of the device
     if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
@@ -599,58 +1026,50 @@ int main(void)
         printf("api_crc_init status code = %d\n", status);
         return 1;
     }
-    printf("api_crc_init status code = %d\n", status);
 
-    // init of the Register state
-    if ((status = api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS))
+    // init of the tables
+    status = api_crc_tableOfType(&device, (uint64_t*) tableSlicing, api_crc_sizeofTableOfType(polynomial, API_CRC_TABLE_SLICING_BY_8), API_CRC_TABLE_SLICING_BY_8);
+    printf("api_crc_tableOfType status code = %d\n", status);
+    if (status == API_CRC_STATUS_SUCCESS)
     {
-        // Error handling...
-        printf("api_crc_reset status code = %d\n", status);
-        return 1;
+        // CRC processing
+        if (crc_processing(&device, &state, bufferCRC32, offset, buffer_size) == 1)
+        {
+            return 1;
+        }
+
+        // CRC check
+        output_Check(crc_Value, &state);
     }
-    printf("api_crc_reset status code = %d\n", status);
-
-    // CRC processing
-    clockStart = clock();
-    status = api_crc_process(&device, &state, ARR, offset, buffer_size);
-    clockEnd = clock();
-    if (status != API_CRC_STATUS_SUCCESS)
+    else if (status == API_CRC_STATUS_NOT_SUPPORTED)
     {
-        // Error handling...
-        printf("api_crc_process status code = %d\n", status);
-        return 1;
+        printf("Slicing-by-8 is not supported by this build of the library\n\n");
     }
-    printf("api_crc_process status code = %d\n", status);
-
-    // Finalisation
-    if ((status = api_crc_finalize(&device, &state) != API_CRC_STATUS_SUCCESS))
+    else
     {
-        // Error handling...
-        printf("api_crc_finalize status code = %d\n", status);
-        return 1;
+        printf("Status of api_crc_tableOfType(device, table, size, type) is not Ok\n\n");
     }
-    printf("api_crc_finalize status code = %d\n", status);
-    printf("CRC Rest = %llx\n", (unsigned long long) state);
-
-    output_Check(crc_Value, &state);
 
-    clockElapsedSeconds = ((double)(clockEnd - clockStart)) / CLOCKS_PER_SEC;
-    printf("Processing for %d bits took %f seconds\n", buffer_size, clockElapsedSeconds);
-    printf("The speed of Processing %.2f bits per millisecond\n\n\n", buffer_size/clockElapsedSeconds/1000);
-#if 1
     //------------------------------------------------------------------------------
-    // Test Case 3.2.
+    // Test Case 2.9.
     //------------------------------------------------------------------------------
     printf("/******************************************************************************/\n");
-    printf("/* Test Case 3.2.                                                             */\n");
-    printf("/* Performance Test for CRC-32 Reverse LFSR                                   */\n");
+    printf("/* Test Case 2.9.                                                             */\n");
+    printf("/* ### Slicing-by-16 : CRC-16 ###                                             */\n");
+    printf("/* generator polynomial: G(x) = x^16 + x^15 + x^2 + 1                         */\n");
+    printf("/* initial:              0b0000000000000000 (0x00)                            */\n");
+    printf("/* outputXOR:            0b0000000000000000 (0x00)                            */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (5x)    */\n");
+    printf("/* CRC-16:          0xD671                                                    */\n");
     printf("/******************************************************************************/\n");
-    polynomial = 0x82608EDB;
-    inputXOR = 0xFFFFFFFF;
+    polynomial = 0xC002;
+    inputXOR = 0x00;
     outputXOR = 0x00;
     inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
     outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
-    crc_Value = 0x4C36D339;
+    buffer_size = (sizeof(bufferCRC32)/sizeof(uint8_t))*8;
+    crc_Value = 0xD671;
 
     // init of the device
     if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
@@ -659,12 +1078,1395 @@ int main(void)
         printf("api_crc_init status code = %d\n", status);
         return 1;
     }
-    printf("api_crc_init status code = %d\n", status);
 
-    // init of the Register state
-    if ((status = api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS))
+    // init of the tables
+    status = api_crc_tableOfType(&device, (uint64_t*) tableSlicing, api_crc_sizeofTableOfType(polynomial, API_CRC_TABLE_SLICING_BY_16), API_CRC_TABLE_SLICING_BY_16);
+    printf("api_crc_tableOfType status code = %d\n", status);
+    if (status == API_CRC_STATUS_SUCCESS)
     {
-        // Error handling...
+        // CRC processing
+        if (crc_processing(&device, &state, bufferCRC32, offset, buffer_size) == 1)
+        {
+            return 1;
+        }
+
+        // CRC check
+        output_Check(crc_Value, &state);
+    }
+    else if (status == API_CRC_STATUS_NOT_SUPPORTED)
+    {
+        printf("Slicing-by-16 is not supported by this build of the library\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_tableOfType(device, table, size, type) is not Ok\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.10.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.10.                                                            */\n");
+    printf("/* ### Folding (PCLMULQDQ) : CRC-32 ###                                       */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC32:           0xb1fc4bbc                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    uint8_t bufferFolding[100];
+    for (n = 0U; n < sizeof(bufferFolding); n++)
+    {
+        bufferFolding[n] = 0x30 + n%10;
+    }
+    buffer_size = (sizeof(bufferFolding)/sizeof(uint8_t))*8;
+    crc_Value = 0xb1fc4bbc;
+
+    // init of the device, the byte-wise table is used for the remaining bytes
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, table, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    if ((status = api_crc_table(&device, table, api_crc_sizeofTable(polynomial))) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_table status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC processing
+    if (crc_processing(&device, &state, bufferFolding, offset, buffer_size) == 1)
+    {
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.11.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.11.                                                            */\n");
+    printf("/* ### Instruction CRC32 (SSE4.2) : CRC-32C ###                               */\n");
+    printf("/* generator polynom:  G(x)=0x1EDC6F41 (Castagnoli)                           */\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC-32C:         0x90cdf36e                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x8F6E37A0;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    buffer_size = (sizeof(bufferFolding)/sizeof(uint8_t))*8;
+    crc_Value = 0x90cdf36e;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, table, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    if ((status = api_crc_table(&device, table, api_crc_sizeofTable(polynomial))) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_table status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC processing
+    if (crc_processing(&device, &state, bufferFolding, offset, buffer_size) == 1)
+    {
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.11. (without table)                                            */\n");
+    printf("/* ### Instruction CRC32 (SSE4.2) : CRC-32C ###                               */\n");
+    printf("/* generator polynom:  G(x)=0x1EDC6F41 (Castagnoli)                           */\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/*                  bits 4 to 796 (793 bits)                                  */\n");
+    printf("/* CRC-32C:         0xef2753b7                                                */\n");
+    printf("/******************************************************************************/\n");
+    crc_Value = 0xef2753b7;
+
+    // init of the device without a table
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC processing, the leading and trailing bits are not whole bytes
+    if (crc_processing(&device, &state, bufferFolding, 4U, 793U) == 1)
+    {
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.12.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.12.                                                            */\n");
+    printf("/* ### Table of half bytes (16 entries) : CRC32 ###                           */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* outputXOR:            0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* Bits Order:           MSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (5x)    */\n");
+    printf("/* CRC32:           0x24a56cf5                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0x00;
+    outputXOR = 0x00;
+    inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    buffer_size = (sizeof(bufferCRC32)/sizeof(uint8_t))*8;
+    crc_Value = 0x24a56cf5;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // init of the table
+    table_size = api_crc_sizeofTableOfType(polynomial, API_CRC_TABLE_NIBBLE);
+    printf("table_size = %d\n", table_size);
+    status = api_crc_tableOfType(&device, table, table_size, API_CRC_TABLE_NIBBLE);
+    printf("api_crc_tableOfType status code = %d\n", status);
+    if (status == API_CRC_STATUS_SUCCESS)
+    {
+        // CRC processing
+        if (crc_processing(&device, &state, bufferCRC32, offset, buffer_size) == 1)
+        {
+            return 1;
+        }
+
+        // CRC check
+        output_Check(crc_Value, &state);
+    }
+    else if (status == API_CRC_STATUS_NOT_SUPPORTED)
+    {
+        printf("The table of half bytes is not supported by this build of the library\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_tableOfType(device, table, size, type) is not Ok\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.13.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.13.                                                            */\n");
+    printf("/* ### Table of two bytes (65536 entries) : CRC32 ###                         */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* outputXOR:            0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* Bits Order:           MSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (5x)    */\n");
+    printf("/* CRC32:           0x24a56cf5                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0x00;
+    outputXOR = 0x00;
+    inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    buffer_size = (sizeof(bufferCRC32)/sizeof(uint8_t))*8;
+    crc_Value = 0x24a56cf5;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // init of the table
+    static uint32_t tableWord[65536];
+    table_size = api_crc_sizeofTableOfType(polynomial, API_CRC_TABLE_WORD);
+    printf("table_size = %d\n", table_size);
+    status = api_crc_tableOfType(&device, (uint64_t*) tableWord, table_size, API_CRC_TABLE_WORD);
+    printf("api_crc_tableOfType status code = %d\n", status);
+    if (status == API_CRC_STATUS_SUCCESS)
+    {
+        // CRC processing
+        if (crc_processing(&device, &state, bufferCRC32, offset, buffer_size) == 1)
+        {
+            return 1;
+        }
+
+        // CRC check
+        output_Check(crc_Value, &state);
+    }
+    else if (status == API_CRC_STATUS_NOT_SUPPORTED)
+    {
+        printf("The table of two bytes is not supported by this build of the library\n\n");
+    }
+    else
+    {
+        printf("Status of api_crc_tableOfType(device, table, size, type) is not Ok\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.14.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.14.                                                            */\n");
+    printf("/* ### Directly LFSR Barrett (BUILD_FOR_SIZE) : CRC-64/XZ ###                 */\n");
+    printf("/* generator polynom:  G(x)=0x42F0E1EBA9EA3693 (ECMA-182)                     */\n");
+    printf("/* initial:              0xFFFFFFFFFFFFFFFF                                   */\n");
+    printf("/* outputXOR:            0xFFFFFFFFFFFFFFFF                                   */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC-64:          0xd7427d2f75bc2c2d                                        */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0xA17870F5D4F51B49;
+    inputXOR = 0xFFFFFFFFFFFFFFFF;
+    outputXOR = 0xFFFFFFFFFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    buffer_size = (sizeof(bufferFolding)/sizeof(uint8_t))*8;
+    crc_Value = 0xd7427d2f75bc2c2d;
+
+    // init of the device without a table
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC processing
+    if (crc_processing(&device, &state, bufferFolding, offset, buffer_size) == 1)
+    {
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.15.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.15.                                                            */\n");
+    printf("/* ### Each engine of the CPU : CRC-32 ###                                    */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (480x)  */\n");
+    printf("/* CRC32:           0x4e9dac58                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    static uint8_t bufferEngine[4800];
+    for (n = 0U; n < sizeof(bufferEngine); n++)
+    {
+        bufferEngine[n] = 0x30 + n%10;
+    }
+    buffer_size = (sizeof(bufferEngine)/sizeof(uint8_t))*8;
+    crc_Value = 0x4e9dac58;
+
+    // init of the device with the byte-wise table
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, table, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    if ((status = api_crc_table(&device, table, api_crc_sizeofTable(polynomial))) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_table status code = %d\n", status);
+        return 1;
+    }
+
+    for (n = API_CRC_ENGINE_TABLE; n <= API_CRC_ENGINE_CRC32C; n++)
+    {
+        if (api_crc_setEngine((api_crc_engine_e)n) != API_CRC_STATUS_SUCCESS)
+        {
+            printf("Engine %d is not supported by this CPU or build of the library\n\n", n);
+            continue;
+        }
+        printf("Engine %d\n", api_crc_getEngine());
+
+        // CRC processing
+        if (crc_processing(&device, &state, bufferEngine, offset, buffer_size) == 1)
+        {
+            return 1;
+        }
+
+        // CRC check
+        output_Check(crc_Value, &state);
+    }
+    api_crc_setEngine(API_CRC_ENGINE_AUTO);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.16.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.16.                                                            */\n");
+    printf("/* ### Combination of two segments (301 + 499 bits) : CRC-32 ###              */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC32:           0xb1fc4bbc                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0xb1fc4bbc;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC processing of the segment B: bits 301 to 799
+    if (crc_processing(&device, &state, &bufferFolding[301U >> 3U], 301U & 7U, 499U) == 1)
+    {
+        return 1;
+    }
+    api_crc_state_t stateB = state;
+
+    // CRC processing of the segment A: bits 0 to 300
+    if (crc_processing(&device, &state, bufferFolding, offset, 301U) == 1)
+    {
+        return 1;
+    }
+
+    if ((status = api_crc_combine(&device, &state, stateB, 499U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_combine status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.16. (mixed bit orders)                                         */\n");
+    printf("/* ### Combination of two segments (301 + 499 bits) : CRC-40/GSM ###          */\n");
+    printf("/* generator polynom:  G(x)=x40+x26+x23+x17+x3+1                              */\n");
+    printf("/* initial:              0x0000000000                                         */\n");
+    printf("/* outputXOR:            0xFFFFFFFFFF                                         */\n");
+    printf("/* Bits Order:           Input LSB, Output MSB                                */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC40:           0xa08391a6bb                                              */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x8002410004;
+    inputXOR = 0x0000000000;
+    outputXOR = 0xFFFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    crc_Value = 0xa08391a6bb;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC processing of the segment B: bits 301 to 799
+    if (crc_processing(&device, &state, &bufferFolding[301U >> 3U], 301U & 7U, 499U) == 1)
+    {
+        return 1;
+    }
+    stateB = state;
+
+    // CRC processing of the segment A: bits 0 to 300
+    if (crc_processing(&device, &state, bufferFolding, offset, 301U) == 1)
+    {
+        return 1;
+    }
+
+    if ((status = api_crc_combine(&device, &state, stateB, 499U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_combine status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.17.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.17.                                                            */\n");
+    printf("/* ### Run of a constant byte without data : CRC-32 ###                       */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x61 (1000000x)                                           */\n");
+    printf("/* CRC32:           0xdc25bfbc                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0xdc25bfbc;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    api_crc_reset(&device, &state);
+    if ((status = api_crc_processConstant(&device, &state, 0x61, 1000000U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processConstant status code = %d\n", status);
+        return 1;
+    }
+    api_crc_finalize(&device, &state);
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.18.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.18.                                                            */\n");
+    printf("/* ### Run of zeros without data : CRC32 ###                                  */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* outputXOR:            0b00000000000000000000000000000000 (0x00)            */\n");
+    printf("/* Bits Order:           MSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (5x)    */\n");
+    printf("/*                  0x00 (1000x)                                              */\n");
+    printf("/* CRC32:           0x81ec9af8                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0x00;
+    outputXOR = 0x00;
+    inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    buffer_size = (sizeof(bufferCRC32)/sizeof(uint8_t))*8;
+    crc_Value = 0x81ec9af8;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    api_crc_reset(&device, &state);
+    api_crc_process(&device, &state, bufferCRC32, offset, buffer_size);
+    if ((status = api_crc_processZeros(&device, &state, 1000U << 3U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processZeros status code = %d\n", status);
+        return 1;
+    }
+    api_crc_finalize(&device, &state);
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.19.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.19.                                                            */\n");
+    printf("/* ### Patch of the bytes 10 to 13 (\"0123\" -> \"ABCD\") : CRC-32 ###            */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC32:           0xb1fc4bbc -> 0xd949e472                                  */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    uint8_t bufferPatch[] = {0x41, 0x42, 0x43, 0x44};
+    crc_Value = 0xd949e472;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the CRC value before the patch
+    state = 0xb1fc4bbc;
+    if ((status = api_crc_patch(&device, &state, 10U, &bufferFolding[10U], bufferPatch, sizeof(bufferPatch), sizeof(bufferFolding))) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_patch status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.20.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.20.                                                            */\n");
+    printf("/* ### Removal of the prefix (301 of 800 bits) : CRC-32 ###                   */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC32:           0xb1fc4bbc -> 0x816e87a4                                  */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0x816e87a4;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the CRC values of all 800 bits and of the first 301 bits
+    state = 0xb1fc4bbc;
+    if ((status = api_crc_removePrefix(&device, &state, 0x6240f34a, 499U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_removePrefix status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.20. (mixed bit orders)                                         */\n");
+    printf("/* ### Removal of the prefix (301 of 800 bits) : CRC-40/GSM ###               */\n");
+    printf("/* generator polynom:  G(x)=x40+x26+x23+x17+x3+1                              */\n");
+    printf("/* initial:              0x0000000000                                         */\n");
+    printf("/* outputXOR:            0xFFFFFFFFFF                                         */\n");
+    printf("/* Bits Order:           Input LSB, Output MSB                                */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC40:           0xa08391a6bb -> 0xb02e89d4af                              */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x8002410004;
+    inputXOR = 0x0000000000;
+    outputXOR = 0xFFFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    crc_Value = 0xb02e89d4af;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the CRC values of all 800 bits and of the first 301 bits
+    state = 0xa08391a6bb;
+    if ((status = api_crc_removePrefix(&device, &state, 0x2631d7eb7b, 499U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_removePrefix status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.21.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.21.                                                            */\n");
+    printf("/* ### Removal of the suffix (499 of 800 bits) : CRC-32 ###                   */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           MSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC32:           0xe0f7f2f5 -> 0x20e52d1c                                  */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    crc_Value = 0x20e52d1c;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the CRC values of all 800 bits and of the last 499 bits
+    state = 0xe0f7f2f5;
+    if ((status = api_crc_removeSuffix(&device, &state, 0x437d8f28, 499U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_removeSuffix status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.21. (mixed bit orders)                                         */\n");
+    printf("/* ### Removal of the suffix (499 of 800 bits) : CRC-40/GSM ###               */\n");
+    printf("/* generator polynom:  G(x)=x40+x26+x23+x17+x3+1                              */\n");
+    printf("/* initial:              0x0000000000                                         */\n");
+    printf("/* outputXOR:            0xFFFFFFFFFF                                         */\n");
+    printf("/* Bits Order:           Input MSB, Output LSB                                */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* CRC40:           0x94c78dd6bf -> 0x4545ee1516                              */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x8002410004;
+    inputXOR = 0x0000000000;
+    outputXOR = 0xFFFFFFFFFF;
+    inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0x4545ee1516;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the CRC values of all 800 bits and of the last 499 bits
+    state = 0x94c78dd6bf;
+    if ((status = api_crc_removeSuffix(&device, &state, 0xda14c28589, 499U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_removeSuffix status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.22.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.22.                                                            */\n");
+    printf("/* ### CRC-16/MODBUS from the raw remainder of CRC-16/ARC ###                 */\n");
+    printf("/* generator polynomial: G(x) = x^16 + x^15 + x^2 + 1                         */\n");
+    printf("/* initial:              0b1111111111111111 (0xFFFF)                          */\n");
+    printf("/* outputXOR:            0b0000000000000000 (0x00)                            */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39              */\n");
+    printf("/* CRC-16:          0xBB3D -> 0x4B37                                          */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0xC002;
+    inputXOR = 0x0000;
+    outputXOR = 0x0000;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0x4B37;
+
+    // init of the device CRC-16/ARC
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the raw remainder: the register starts from zero
+    state = 0U;
+    if ((status = api_crc_process(&device, &state, bufferCRC16, offset, sizeof(bufferCRC16) << 3U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_process status code = %d\n", status);
+        return 1;
+    }
+
+    // init of the device CRC-16/MODBUS
+    inputXOR = 0xFFFF;
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    if ((status = api_crc_derive(&device, &state, sizeof(bufferCRC16) << 3U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_derive status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.23.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.23.                                                            */\n");
+    printf("/* ### Factors and period of the generator polynomial : CRC-16 ###            */\n");
+    printf("/* generator polynomial: G(x) = x^16 + x^15 + x^2 + 1                         */\n");
+    printf("/* factors:              (x + 1) * (x^15 + x + 1) (0x1, 0x4001)               */\n");
+    printf("/* period:               32767 (0x7FFF)                                       */\n");
+    printf("/* irreducible:          no                                                   */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0xC002;
+    uint8_t irreducible = 1U;
+
+    if (((status = api_crc_polyFactor(polynomial, factors, &count)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_polyPeriod(polynomial, &value)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_polyIsIrreducible(polynomial, &irreducible)) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_poly* status code = %d\n", status);
+        return 1;
+    }
+
+    if ((count == 2U) && (factors[0U] == 0x1U) && (factors[1U] == 0x4001U) && (value == 0x7FFFU) && (irreducible == 0U))
+    {
+        printf("Factors and period of the polynomial 0x%llx are Ok\n\n\n", (unsigned long long)polynomial);
+    }
+    else
+    {
+        printf("Factors and period of the polynomial 0x%llx are not Ok\n\n\n", (unsigned long long)polynomial);
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.24.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.24.                                                            */\n");
+    printf("/* ### Primitivity of the generator polynomial : CRC-32 ###                   */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* period:               4294967295 (0xFFFFFFFF)                              */\n");
+    printf("/* primitive:            yes                                                  */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    uint8_t primitive = 0U;
+
+    if (((status = api_crc_polyPeriod(polynomial, &value)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_polyIsPrimitive(polynomial, &primitive)) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_poly* status code = %d\n", status);
+        return 1;
+    }
+
+    if ((value == 0xFFFFFFFFU) && (primitive == 1U))
+    {
+        printf("Period and primitivity of the polynomial 0x%llx are Ok\n\n\n", (unsigned long long)polynomial);
+    }
+    else
+    {
+        printf("Period and primitivity of the polynomial 0x%llx are not Ok\n\n\n", (unsigned long long)polynomial);
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.25.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.25.                                                            */\n");
+    printf("/* ### Rolling CRC over a window of 16 bytes, LUT : CRC-32 ###                */\n");
+    printf("/* generator polynom:  G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1*/\n");
+    printf("/* initial:              0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* outputXOR:            0b11111111111111111111111111111111 (0xFFFFFFFF)      */\n");
+    printf("/* Bits Order:           LSB                                                  */\n");
+    printf("/* data:            0x30 0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 (10x)   */\n");
+    printf("/* window:          the last 16 bytes \"4567890123456789\"                      */\n");
+    printf("/* CRC32:           0x1ba023cd                                                */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0xFFFFFFFF;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0x1ba023cd;
+
+    // init of the device
+    if (((status = api_crc_init(polynomial, inputXOR, outputXOR, table, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_table(&device, table, api_crc_sizeofTable(polynomial))) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_rollTable(&device, tableRoll, api_crc_sizeofTable(polynomial), 16U)) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    // the register of the first window, then one byte per step
+    api_crc_reset(&device, &state);
+    api_crc_process(&device, &state, bufferFolding, offset, 16U << 3U);
+
+    for (n = 16U; n < sizeof(bufferFolding); n++)
+    {
+        if ((status = api_crc_roll(&device, tableRoll, &state, bufferFolding[n - 16U], bufferFolding[n])) != API_CRC_STATUS_SUCCESS)
+        {
+            // Error handling
+            printf("api_crc_roll status code = %d\n", status);
+            return 1;
+        }
+    }
+
+    // CRC check
+    api_crc_finalize(&device, &state);
+    output_Check(crc_Value, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.26.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.26.                                                            */\n");
+    printf("/* ### Content-defined chunking with a rolling CRC window, LUT : CRC-32 ###   */\n");
+    printf("/* chunks:          256 to 4096 bytes, 1024 bytes on average, window 32 bytes */\n");
+    printf("/* data:            65536 pseudo-random bytes (xorshift32)                    */\n");
+    printf("/* check:           the chunks cover the data, their checksums match the CRC  */\n");
+    printf("/*                  of the chunk, the boundaries are found again after the    */\n");
+    printf("/*                  first byte of the data is removed                         */\n");
+    printf("/******************************************************************************/\n");
+    static uint8_t bufferChunk[65536U];
+    uint32_t boundaries[256U];
+    uint32_t boundary = 0U;
+    uint32_t chunks = 0U;
+    uint32_t found = 0U;
+    uint32_t seed = 2463534242U;
+    api_crc_state_t stateChunk = 0U;
+    uint8_t chunkOk = 1U;
+
+    for (n = 0U; n < sizeof(bufferChunk); n++)
+    {
+        seed ^= seed << 13U;
+        seed ^= seed >> 17U;
+        seed ^= seed << 5U;
+        bufferChunk[n] = (uint8_t) seed;
+    }
+
+    // the device of the test case 2.25
+    if ((status = api_crc_chunkerInit(&device, 256U, 1024U, 4096U, 32U, &chunker)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_chunkerInit status code = %d\n", status);
+        return 1;
+    }
+
+    for (n = 0U; n < sizeof(bufferChunk); n += length)
+    {
+        api_crc_chunk(&chunker, &bufferChunk[n], sizeof(bufferChunk) - n, &length, &state);
+        api_crc_reset(&device, &stateChunk);
+        api_crc_process(&device, &stateChunk, &bufferChunk[n], offset, length << 3U);
+        api_crc_finalize(&device, &stateChunk);
+        chunkOk &= (state == stateChunk) & (length <= 4096U) & ((length >= 256U) | (n + length == sizeof(bufferChunk)));
+        boundaries[chunks++ % 256U] = n + length;
+    }
+
+    // without the first byte, the boundaries after the first chunks are the same
+    for (n = 1U; n < sizeof(bufferChunk); n += length)
+    {
+        api_crc_chunk(&chunker, &bufferChunk[n], sizeof(bufferChunk) - n, &length, &state);
+        for (boundary = 0U; (boundary < chunks) && (boundary < 256U); boundary++)
+        {
+            found += (boundaries[boundary] == (n + length));
+        }
+    }
+    printf("Number of the chunks = %d, average size = %d bytes, boundaries found again = %d\n", chunks, (uint32_t) (sizeof(bufferChunk) / chunks), found);
+
+    if ((chunkOk != 0U) & (chunks <= 256U) & ((found + 2U) >= chunks))
+    {
+        printf("Status of the content-defined chunking is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of the content-defined chunking is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.27.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.27.                                                            */\n");
+    printf("/* ### CRC-16 and CRC-32 in one pass over the buffer ###                      */\n");
+    printf("/* CRC-16:          G(x) = x^16 + x^15 + x^2 + 1, LSB                         */\n");
+    printf("/* CRC-32:          G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1   */\n");
+    printf("/*                  initial and outputXOR 0xFFFFFFFF, LSB                     */\n");
+    printf("/* data:            0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39              */\n");
+    printf("/* CRC-16:          0xBB3D                                                    */\n");
+    printf("/* CRC32:           0xCBF43926                                                */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_device_s deviceCRC16;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    if (((status = api_crc_init(0xC002, 0x00, 0x00, 0U, inputOrder, inputOrder, &deviceCRC16)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_init(0x82608EDB, 0xFFFFFFFF, 0xFFFFFFFF, table, inputOrder, inputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_table(&device, table, api_crc_sizeofTable(0x82608EDB))) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    devices[0U] = &deviceCRC16;
+    devices[1U] = &device;
+    api_crc_reset(devices[0U], &states[0U]);
+    api_crc_reset(devices[1U], &states[1U]);
+    if ((status = api_crc_processMulti(devices, states, 2U, bufferCRC16, offset, sizeof(bufferCRC16) << 3U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processMulti status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    api_crc_finalize(devices[0U], &states[0U]);
+    api_crc_finalize(devices[1U], &states[1U]);
+    output_Check(0xBB3D, &states[0U]);
+    output_Check(0xCBF43926, &states[1U]);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.28.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.28.                                                            */\n");
+    printf("/* ### CRC-16 and CRC-32 of a bit stream in chunks of any bits ###            */\n");
+    printf("/* CRC-16:          G(x) = x^16 + x^15 + x^2 + 1, LSB                         */\n");
+    printf("/* CRC-32:          G(x)=x32+x26+x23+x22+x16+x12+x11+x10+x8+x7+x5+x4+x2+x+1   */\n");
+    printf("/*                  initial and outputXOR 0xFFFFFFFF, LSB                     */\n");
+    printf("/* data:            0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39              */\n");
+    printf("/* chunks:          5, 13, 30 and 24 bits                                     */\n");
+    printf("/* CRC-16:          0xBB3D                                                    */\n");
+    printf("/* CRC32:           0xCBF43926                                                */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_cursor_s cursorCRC16;
+    if (((status = api_crc_cursorInit(&deviceCRC16, &cursorCRC16)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_cursorInit(&device, &cursor)) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_cursorInit status code = %d\n", status);
+        return 1;
+    }
+
+    // the chunks start in the byte, in which the chunk before ends
+    api_crc_cursorProcess(&cursorCRC16, &bufferCRC16[0U], 0U, 5U);
+    api_crc_cursorProcess(&cursorCRC16, &bufferCRC16[0U], 5U, 13U);
+    api_crc_cursorProcess(&cursorCRC16, &bufferCRC16[2U], 2U, 30U);
+    api_crc_cursorProcess(&cursorCRC16, &bufferCRC16[6U], 0U, 24U);
+    api_crc_cursorProcess(&cursor, &bufferCRC16[0U], 0U, 5U);
+    api_crc_cursorProcess(&cursor, &bufferCRC16[0U], 5U, 13U);
+    api_crc_cursorProcess(&cursor, &bufferCRC16[2U], 2U, 30U);
+    api_crc_cursorProcess(&cursor, &bufferCRC16[6U], 0U, 24U);
+
+    // CRC check
+    api_crc_cursorFinalize(&cursorCRC16, &states[0U]);
+    api_crc_cursorFinalize(&cursor, &states[1U]);
+    output_Check(0xBB3D, &states[0U]);
+    output_Check(0xCBF43926, &states[1U]);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.29.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.29.                                                            */\n");
+    printf("/* ### CRC-32 in 4 parallel threads, LUT : CRC-32 ###                         */\n");
+    printf("/* data:            the 65536 bytes of the test case 2.26, from the bit 3 of  */\n");
+    printf("/*                  the first byte, 524275 bits                               */\n");
+    printf("/* segments:        at least 1024 bytes                                       */\n");
+    printf("/* check:           the CRC value of api_crc_process                          */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_reset(&device, &stateChunk);
+    api_crc_process(&device, &stateChunk, bufferChunk, 3U, (sizeof(bufferChunk) << 3U) - 13U);
+    api_crc_finalize(&device, &stateChunk);
+
+    api_crc_reset(&device, &state);
+    if ((status = api_crc_processParallel(&device, &state, bufferChunk, 3U, (sizeof(bufferChunk) << 3U) - 13U, 4U, 1024U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processParallel status code = %d\n", status);
+        return 1;
+    }
+
+    // CRC check
+    api_crc_finalize(&device, &state);
+    output_Check(stateChunk, &state);
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.30.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.30.                                                            */\n");
+    printf("/* ### CRC-32 of 20 messages in one batch, LUT : CRC-32 ###                   */\n");
+    printf("/* data:            0x31 0x32 0x33 0x34 0x35 0x36 0x37 0x38 0x39 and 19       */\n");
+    printf("/*                  messages of 0 to 300 bytes of the test case 2.26          */\n");
+    printf("/* CRC-32:          0xCBF43926 and the CRC values of api_crc_process          */\n");
+    printf("/******************************************************************************/\n");
+    uint8_t const *messages[20U];
+    uint32_t messageSizes[20U];
+    api_crc_state_t messageStates[20U];
+    uint8_t batchOk = 1U;
+
+    messages[0U] = bufferCRC16;
+    messageSizes[0U] = sizeof(bufferCRC16);
+    for (n = 1U; n < 20U; n++)
+    {
+        messages[n] = &bufferChunk[n * 1000U];
+        messageSizes[n] = (n * n * 7U) % 301U;
+    }
+
+    if ((status = api_crc_processBatch(&device, messages, messageSizes, messageStates, 20U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processBatch status code = %d\n", status);
+        return 1;
+    }
+
+    for (n = 1U; n < 20U; n++)
+    {
+        api_crc_reset(&device, &stateChunk);
+        api_crc_process(&device, &stateChunk, messages[n], 0U, messageSizes[n] << 3U);
+        api_crc_finalize(&device, &stateChunk);
+        batchOk &= (messageStates[n] == stateChunk);
+    }
+
+    // CRC check
+    output_Check(0xCBF43926, &messageStates[0U]);
+    if (batchOk != 0U)
+    {
+        printf("Status of the CRC values of the batch is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of the CRC values of the batch is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.31.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.31.                                                            */\n");
+    printf("/* ### Bit-sliced CRC-5 and CRC-32 of 100 messages of a few bits ###          */\n");
+    printf("/* CRC-5:           G3 : CENELEC of the test case 2.2, MSB                    */\n");
+    printf("/* CRC-32:          LUT : CRC-32 of the test case 2.30, LSB                   */\n");
+    printf("/* data:            1010100100001010001111110001 (A9 0A 3F 1) and 99          */\n");
+    printf("/*                  messages of 0 to 200 bits of the test case 2.26           */\n");
+    printf("/* CRC5:            00111 (0x07) and the CRC values of api_crc_process        */\n");
+    printf("/******************************************************************************/\n");
+    api_crc_device_s deviceCRC05;
+    uint8_t const *bitMessages[100U];
+    uint32_t bitSizes[100U];
+    api_crc_state_t bitStates[100U];
+
+    if ((status = api_crc_init(0x12, 0x1F, 0x1F, 0U, API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT,
+                               API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT, &deviceCRC05)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    bitMessages[0U] = bufferCRC05;
+    bitSizes[0U] = 28U;
+    for (n = 1U; n < 100U; n++)
+    {
+        bitMessages[n] = &bufferChunk[n * 300U];
+        bitSizes[n] = (n < 90U) ? (11U + (n * 13U) % 30U) : ((n * n * 7U) % 201U);
+    }
+
+    batchOk = 1U;
+    devices[0U] = &deviceCRC05;
+    devices[1U] = &device;
+    for (n = 0U; n < 2U; n++)
+    {
+        if ((status = api_crc_processBatchBits(devices[n], bitMessages, bitSizes, bitStates, 100U)) != API_CRC_STATUS_SUCCESS)
+        {
+            // Error handling
+            printf("api_crc_processBatchBits status code = %d\n", status);
+            return 1;
+        }
+
+        for (length = 1U; length < 100U; length++)
+        {
+            api_crc_reset(devices[n], &stateChunk);
+            api_crc_process(devices[n], &stateChunk, bitMessages[length], 0U, bitSizes[length]);
+            api_crc_finalize(devices[n], &stateChunk);
+            batchOk &= (bitStates[length] == stateChunk);
+        }
+
+        if (n == 0U)
+        {
+            // CRC check
+            output_Check(0x07, &bitStates[0U]);
+        }
+    }
+
+    if (batchOk != 0U)
+    {
+        printf("Status of the CRC values of the bit-sliced batch is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of the CRC values of the bit-sliced batch is not Ok\n\n\n");
+    }
+
+#ifdef API_CRC_IOVEC
+    //------------------------------------------------------------------------------
+    // Test Case 2.32.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.32.                                                            */\n");
+    printf("/* ### CRC-32 of an I/O vector, LUT : CRC-32 of the test case 2.30 ###        */\n");
+    printf("/* data:            0x31 0x32 | | 0x33 0x34 0x35 0x36 | 0x37 0x38 0x39 and    */\n");
+    printf("/*                  64 KB of the test case 2.26 in segments of 0 to 300 bytes */\n");
+    printf("/* CRC-32:          0xCBF43926 and the CRC value of api_crc_process           */\n");
+    printf("/******************************************************************************/\n");
+    struct iovec segments[400U] = {{&bufferCRC16[0U], 2U}, {0U, 0U}, {&bufferCRC16[2U], 4U}, {&bufferCRC16[6U], 3U}};
+
+    api_crc_reset(&device, &state);
+    if ((status = api_crc_processv(&device, &state, segments, 4U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processv status code = %d\n", status);
+        return 1;
+    }
+    api_crc_finalize(&device, &state);
+
+    // CRC check
+    output_Check(0xCBF43926, &state);
+
+    for (n = 0U, length = 0U; (n < 400U) && (length < sizeof(bufferChunk)); n++)
+    {
+        segments[n].iov_base = &bufferChunk[length];
+        segments[n].iov_len = ((n * n * 7U) % 301U < sizeof(bufferChunk) - length) ? ((n * n * 7U) % 301U) : (sizeof(bufferChunk) - length);
+        length += segments[n].iov_len;
+    }
+
+    api_crc_reset(&device, &state);
+    api_crc_processv(&device, &state, segments, n);
+    api_crc_finalize(&device, &state);
+    api_crc_reset(&device, &stateChunk);
+    api_crc_process(&device, &stateChunk, bufferChunk, 0U, length << 3U);
+    api_crc_finalize(&device, &stateChunk);
+
+    if (state == stateChunk)
+    {
+        printf("Status of the CRC value of the I/O vector is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of the CRC value of the I/O vector is not Ok\n\n\n");
+    }
+#endif // API_CRC_IOVEC
+
+    //------------------------------------------------------------------------------
+    // Test Case 2.33.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 2.33.                                                            */\n");
+    printf("/* ### CRC-32 of the rows of a 2D buffer, LUT : CRC-32 of test case 2.30 ###  */\n");
+    printf("/* data:            rows 0x31 0x32 0x33 | 0x34 0x35 0x36 | 0x37 0x38 0x39 of  */\n");
+    printf("/*                  3 bytes with a pitch of 5 bytes, and 400 rows of 100      */\n");
+    printf("/*                  bytes with a pitch of 160 bytes of the test case 2.26     */\n");
+    printf("/* CRC-32:          0xCBF43926 and the CRC value of api_crc_process           */\n");
+    printf("/******************************************************************************/\n");
+    uint8_t const bufferRows[] = {0x31, 0x32, 0x33, 0xAA, 0x55, 0x34, 0x35, 0x36, 0xAA, 0x55, 0x37, 0x38, 0x39};
+
+    api_crc_reset(&device, &state);
+    if ((status = api_crc_processStrided(&device, &state, bufferRows, 3U, 5U, 3U)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_processStrided status code = %d\n", status);
+        return 1;
+    }
+    api_crc_finalize(&device, &state);
+
+    // CRC check
+    output_Check(0xCBF43926, &state);
+
+    api_crc_reset(&device, &state);
+    api_crc_processStrided(&device, &state, bufferChunk, 100U, 160U, 400U);
+    api_crc_finalize(&device, &state);
+    api_crc_reset(&device, &stateChunk);
+    for (n = 0U; n < 400U; n++)
+    {
+        api_crc_process(&device, &stateChunk, &bufferChunk[n * 160U], 0U, 100U << 3U);
+    }
+    api_crc_finalize(&device, &stateChunk);
+
+    if (state == stateChunk)
+    {
+        printf("Status of the CRC value of the rows is Ok\n\n\n");
+    }
+    else
+    {
+        printf("Status of the CRC value of the rows is not Ok\n\n\n");
+    }
+
+    //------------------------------------------------------------------------------
+    // Block 3.
+    //------------------------------------------------------------------------------
+    uint32_t N = 1966080U;
+    uint8_t ARR[N];
+
+    for (n = 0U; n < N; n++)
+    {
+		ARR[n] = 0x30 + n%10;
+	}
+
+//    printf("Value of array[] in bytes %d\n", n);
+    buffer_size = (n << 3);
+    clock_t clockStart, clockEnd;
+    double clockElapsedSeconds;
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.1.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.1.                                                             */\n");
+    printf("/* Performance Test for CRC-32 Forward LFSR                                   */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0x00000000;
+    inputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_MOST_SIGNIFICANT_BIT_TO_LEAST_SIGNIFICANT_BIT;
+    crc_Value = 0x57b403d1;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+    printf("api_crc_init status code = %d\n", status);
+
+    // init of the Register state
+    if ((status = api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling...
+        printf("api_crc_reset status code = %d\n", status);
+        return 1;
+    }
+    printf("api_crc_reset status code = %d\n", status);
+
+    // CRC processing
+    clockStart = clock();
+    status = api_crc_process(&device, &state, ARR, offset, buffer_size);
+    clockEnd = clock();
+    if (status != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling...
+        printf("api_crc_process status code = %d\n", status);
+        return 1;
+    }
+    printf("api_crc_process status code = %d\n", status);
+
+    // Finalisation
+    if ((status = api_crc_finalize(&device, &state) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling...
+        printf("api_crc_finalize status code = %d\n", status);
+        return 1;
+    }
+    printf("api_crc_finalize status code = %d\n", status);
+    printf("CRC Rest = %llx\n", (unsigned long long) state);
+
+    output_Check(crc_Value, &state);
+
+    clockElapsedSeconds = ((double)(clockEnd - clockStart)) / CLOCKS_PER_SEC;
+    printf("Processing for %d bits took %f seconds\n", buffer_size, clockElapsedSeconds);
+    printf("The speed of Processing %.2f bits per millisecond\n\n\n", buffer_size/clockElapsedSeconds/1000);
+#if 1
+    //------------------------------------------------------------------------------
+    // Test Case 3.2.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.2.                                                             */\n");
+    printf("/* Performance Test for CRC-32 Reverse LFSR                                   */\n");
+    printf("/******************************************************************************/\n");
+    polynomial = 0x82608EDB;
+    inputXOR = 0xFFFFFFFF;
+    outputXOR = 0x00;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    outputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    crc_Value = 0x4C36D339;
+
+    // init of the device
+    if ((status = api_crc_init(polynomial, inputXOR, outputXOR, 0U, inputOrder, outputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+    printf("api_crc_init status code = %d\n", status);
+
+    // init of the Register state
+    if ((status = api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling...
         printf("api_crc_reset status code = %d\n", status);
         return 1;
     }
@@ -723,7 +2525,7 @@ int main(void)
     printf("api_crc_init status code = %d\n", status);
 
     // init of the table
-    uint16_t table_size = api_crc_sizeofTable(polynomial);
+    table_size = api_crc_sizeofTable(polynomial);
     printf("table_size = %d\n", table_size);
     if ((status = api_crc_table(&device, (uint64_t*) table32, table_size)) != API_CRC_STATUS_SUCCESS)
     {
@@ -768,7 +2570,415 @@ int main(void)
 
     clockElapsedSeconds = ((double)(clockEnd - clockStart)) / CLOCKS_PER_SEC;
     printf("Processing for %d bits took %f seconds\n", buffer_size, clockElapsedSeconds);
-    printf("The speed of Processing %.2f bits per millisecond\n\n", buffer_size/clockElapsedSeconds/1000);
+    printf("The speed of Processing %.2f bits per millisecond\n\n\n", buffer_size/clockElapsedSeconds/1000);
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.4.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.4.                                                             */\n");
+    printf("/* Performance Test for CRC-32 Forward Slicing-by-8 Process                   */\n");
+    printf("/******************************************************************************/\n");
+    crc_Value = 0x57b403d1;
+
+    // init of the tables
+    table_size = api_crc_sizeofTableOfType(polynomial, API_CRC_TABLE_SLICING_BY_8);
+    printf("table_size = %d\n", table_size);
+    status = api_crc_tableOfType(&device, (uint64_t*) tableSlicing, table_size, API_CRC_TABLE_SLICING_BY_8);
+    printf("api_crc_tableOfType status code = %d\n", status);
+    if (status == API_CRC_STATUS_SUCCESS)
+    {
+        // init of the Register state
+        if ((status = api_crc_reset(&device, &state) != API_CRC_STATUS_SUCCESS))
+        {
+            // Error handling...
+            printf("api_crc_reset status code = %d\n", status);
+            return 1;
+        }
+
+        // CRC processing
+        clockStart = clock();
+        status = api_crc_process(&device, &state, ARR, offset, buffer_size);
+        clockEnd = clock();
+        if (status != API_CRC_STATUS_SUCCESS)
+        {
+            // Error handling...
+            printf("api_crc_process status code = %d\n", status);
+            return 1;
+        }
+        printf("api_crc_process status code = %d\n", status);
+
+        // Finalisation
+        if ((status = api_crc_finalize(&device, &state) != API_CRC_STATUS_SUCCESS))
+        {
+            // Error handling...
+            printf("api_crc_finalize status code = %d\n", status);
+            return 1;
+        }
+        printf("CRC Rest = %llx\n", (unsigned long long) state);
+
+        output_Check(crc_Value, &state);
+
+        clockElapsedSeconds = ((double)(clockEnd - clockStart)) / CLOCKS_PER_SEC;
+        printf("Processing for %d bits took %f seconds\n", buffer_size, clockElapsedSeconds);
+        printf("The speed of Processing %.2f bits per millisecond\n\n", buffer_size/clockElapsedSeconds/1000);
+    }
+    else
+    {
+        printf("Slicing-by-8 is not supported by this build of the library\n\n");
+    }
+
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.5.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.5.                                                             */\n");
+    printf("/* Performance Test for CRC-32 of the table layouts by buffer size            */\n");
+    printf("/* (warm: tables in cache, cold: caches evicted before every buffer)          */\n");
+    printf("/******************************************************************************/\n");
+    static uint8_t evict[8U << 20U];
+    uint32_t const layoutSizes[] = {64U, 1024U, 16384U, N};
+    api_crc_table_e const layouts[] = {API_CRC_TABLE_SLICING_BY_8, API_CRC_TABLE_SLICING_BY_16, API_CRC_TABLE_WORD};
+    char const *const layoutNames[] = {"slicing-by-8 ", "slicing-by-16", "word (64K)   "};
+    uint32_t layout, layoutSize;
+
+    printf("layout          buffer [bytes]    warm [MB/s]    cold [MB/s]\n");
+    for (layout = 0U; layout < sizeof(layouts)/sizeof(layouts[0]); layout++)
+    {
+        clockStart = clock();
+        status = api_crc_tableOfType(&device, (uint64_t*) tableWord, api_crc_sizeofTableOfType(polynomial, layouts[layout]), layouts[layout]);
+        clockEnd = clock();
+        if (status != API_CRC_STATUS_SUCCESS)
+        {
+            printf("%s is not supported by this build of the library\n", layoutNames[layout]);
+            continue;
+        }
+        printf("%s   table of %d bytes filled in %f seconds\n", layoutNames[layout], api_crc_sizeofTableOfType(polynomial, layouts[layout]), ((double)(clockEnd - clockStart)) / CLOCKS_PER_SEC);
+
+        for (layoutSize = 0U; layoutSize < sizeof(layoutSizes)/sizeof(layoutSizes[0]); layoutSize++)
+        {
+            printf("%s   %14d   %12.1f   %12.1f\n", layoutNames[layout], layoutSizes[layoutSize],
+                   crc_throughput(&device, ARR, layoutSizes[layoutSize], 0U, 0U),
+                   crc_throughput(&device, ARR, layoutSizes[layoutSize], evict, sizeof(evict)));
+        }
+    }
+    printf("\n");
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.6.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.6.                                                             */\n");
+    printf("/* Performance Test for the content-defined chunking with CRC-32 Reverse LUT  */\n");
+    printf("/* (chunks of 2048 to 65536 bytes, 8192 bytes on average, window 48 bytes)    */\n");
+    printf("/******************************************************************************/\n");
+    static uint8_t bufferData[16U << 20U];
+    char const *const dataNames[] = {"pseudo-random", "../README.md", "../src/api_crc.c", "CRC_static_tests"};
+    uint32_t dataName, dataSize;
+    double dataSpeed = 0.0;
+    FILE *dataFile = NULL;
+
+    polynomial = 0x82608EDB;
+    inputOrder = API_CRC_ORDER_LEAST_SIGNIFICANT_BIT_TO_MOST_SIGNIFICANT_BIT;
+    if (((status = api_crc_init(polynomial, 0xFFFFFFFF, 0xFFFFFFFF, table, inputOrder, inputOrder, &device)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_table(&device, table, api_crc_sizeofTable(polynomial))) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_chunkerInit(&device, 2048U, 8192U, 65536U, 48U, &chunker)) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_chunkerInit status code = %d\n", status);
+        return 1;
+    }
+
+    printf("data                  size [bytes]     chunks   average [bytes]   speed [MB/s]\n");
+    for (dataName = 0U; dataName < sizeof(dataNames)/sizeof(dataNames[0]); dataName++)
+    {
+        if (dataName == 0U)
+        {
+            for (dataSize = 0U; dataSize < sizeof(bufferData); dataSize++)
+            {
+                seed ^= seed << 13U;
+                seed ^= seed >> 17U;
+                seed ^= seed << 5U;
+                bufferData[dataSize] = (uint8_t) seed;
+            }
+        }
+        else
+        {
+            // the real files are read from the directory tst/, missing ones are skipped
+            if ((dataFile = fopen(dataNames[dataName], "rb")) == NULL)
+            {
+                printf("%-18s   not found\n", dataNames[dataName]);
+                continue;
+            }
+            dataSize = fread(bufferData, 1U, sizeof(bufferData), dataFile);
+            fclose(dataFile);
+            if (dataSize == 0U)
+            {
+                continue;
+            }
+        }
+
+        dataSpeed = chunk_throughput(&chunker, bufferData, dataSize, &chunks);
+        printf("%-18s   %12d   %8d   %15d   %12.1f\n", dataNames[dataName], dataSize, chunks, dataSize / chunks, dataSpeed);
+    }
+    printf("\n");
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.7.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.7.                                                             */\n");
+    printf("/* Performance Test for CRC-16 and CRC-32 Reverse LUT on 16 MB of the data,   */\n");
+    printf("/* separate passes over the buffer against one pass by api_crc_processMulti   */\n");
+    printf("/******************************************************************************/\n");
+    uint64_t tableCRC16[256] = {0U};
+    struct timespec timeStart, timeEnd;
+    double elapsedSeparate = 0.0, elapsedMulti = 0.0;
+    uint32_t call;
+
+    if (((status = api_crc_init(0xC002, 0x00, 0x00, tableCRC16, inputOrder, inputOrder, &deviceCRC16)) != API_CRC_STATUS_SUCCESS)
+            || ((status = api_crc_table(&deviceCRC16, tableCRC16, api_crc_sizeofTable(0xC002))) != API_CRC_STATUS_SUCCESS))
+    {
+        // Error handling
+        printf("api_crc_init status code = %d\n", status);
+        return 1;
+    }
+
+    devices[0U] = &deviceCRC16;
+    devices[1U] = &device;
+    for (call = 0U; call < 4U; call++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &timeStart);
+        api_crc_process(devices[0U], &states[0U], bufferData, 0U, sizeof(bufferData) << 3U);
+        api_crc_process(devices[1U], &states[1U], bufferData, 0U, sizeof(bufferData) << 3U);
+        clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+        elapsedSeparate += (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+        clock_gettime(CLOCK_MONOTONIC, &timeStart);
+        api_crc_processMulti(devices, states, 2U, bufferData, 0U, sizeof(bufferData) << 3U);
+        clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+        elapsedMulti += (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+    }
+    printf("passes                speed [MB/s]\n");
+    printf("separate              %12.1f\n", 4.0 * sizeof(bufferData) / elapsedSeparate / 1000000.0);
+    printf("api_crc_processMulti  %12.1f\n", 4.0 * sizeof(bufferData) / elapsedMulti / 1000000.0);
+    printf("\n");
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.8.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.8.                                                             */\n");
+    printf("/* Performance Test for CRC-32 Reverse LUT on 16 MB of the data in chunks of  */\n");
+    printf("/* 37 bits, api_crc_process against api_crc_cursorProcess                     */\n");
+    printf("/******************************************************************************/\n");
+    uint64_t position;
+    uint64_t const positionEnd = (uint64_t) sizeof(bufferData) << 3U;
+
+    api_crc_reset(&device, &state);
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (position = 0U; (position + 37U) <= positionEnd; position += 37U)
+    {
+        api_crc_process(&device, &state, &bufferData[position >> 3U], position & 7U, 37U);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedSeparate = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+    api_crc_finalize(&device, &state);
+
+    api_crc_cursorInit(&device, &cursor);
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (position = 0U; (position + 37U) <= positionEnd; position += 37U)
+    {
+        api_crc_cursorProcess(&cursor, &bufferData[position >> 3U], position & 7U, 37U);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedMulti = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+    api_crc_cursorFinalize(&cursor, &states[0U]);
+
+    printf("calls                 speed [MB/s]\n");
+    printf("api_crc_process       %12.1f\n", sizeof(bufferData) / elapsedSeparate / 1000000.0);
+    printf("api_crc_cursorProcess %12.1f\n", sizeof(bufferData) / elapsedMulti / 1000000.0);
+    output_Check(state, &states[0U]);
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.9.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.9.                                                             */\n");
+    printf("/* Performance Test for CRC-32 Reverse LUT on 16 MB of the data in parallel   */\n");
+    printf("/* threads by api_crc_processParallel, segments of at least 1 MB              */\n");
+    printf("/******************************************************************************/\n");
+    uint8_t threads;
+
+    printf("threads               speed [MB/s]\n");
+    for (threads = 1U; threads <= 8U; threads <<= 1U)
+    {
+        api_crc_reset(&device, &state);
+        clock_gettime(CLOCK_MONOTONIC, &timeStart);
+        api_crc_processParallel(&device, &state, bufferData, 0U, sizeof(bufferData) << 3U, threads, 1U << 20U);
+        clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+        elapsedMulti = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+        printf("%-21d %12.1f\n", threads, sizeof(bufferData) / elapsedMulti / 1000000.0);
+    }
+    printf("\n");
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.10.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.10.                                                            */\n");
+    printf("/* Performance Test for CRC-32 Reverse LUT on 65536 messages of 16 to 63      */\n");
+    printf("/* bytes in the first 64 KB of the data, each by api_crc_reset,               */\n");
+    printf("/* api_crc_process and api_crc_finalize, and all by api_crc_processBatch      */\n");
+    printf("/******************************************************************************/\n");
+    static uint8_t const *batchMessages[65536U];
+    static uint32_t batchMessageSizes[65536U];
+    static api_crc_state_t batchMessageStates[65536U];
+    uint32_t message = 0U;
+
+    for (message = 0U; message < 65536U; message++)
+    {
+        batchMessages[message] = &bufferData[(message * 211U) % 65472U];
+        batchMessageSizes[message] = 16U + (message * 7U) % 48U;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (message = 0U; message < 65536U; message++)
+    {
+        api_crc_reset(&device, &state);
+        api_crc_process(&device, &state, batchMessages[message], 0U, batchMessageSizes[message] << 3U);
+        api_crc_finalize(&device, &state);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedSeparate = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    api_crc_processBatch(&device, batchMessages, batchMessageSizes, batchMessageStates, 65536U);
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedMulti = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    printf("calls                 messages [1/us]\n");
+    printf("api_crc_process       %15.1f\n", 65536.0 / elapsedSeparate / 1000000.0);
+    printf("api_crc_processBatch  %15.1f\n", 65536.0 / elapsedMulti / 1000000.0);
+    output_Check(state, &batchMessageStates[65535U]);
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.11.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.11.                                                            */\n");
+    printf("/* Performance Test for CRC-5 (G3 : CENELEC) on 65536 messages of 11 to 40    */\n");
+    printf("/* bits, each by api_crc_reset, api_crc_process and api_crc_finalize, and all */\n");
+    printf("/* by api_crc_processBatchBits                                                */\n");
+    printf("/******************************************************************************/\n");
+    for (message = 0U; message < 65536U; message++)
+    {
+        batchMessageSizes[message] = 11U + (message * 7U) % 30U;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (message = 0U; message < 65536U; message++)
+    {
+        api_crc_reset(&deviceCRC05, &state);
+        api_crc_process(&deviceCRC05, &state, batchMessages[message], 0U, batchMessageSizes[message]);
+        api_crc_finalize(&deviceCRC05, &state);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedSeparate = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    api_crc_processBatchBits(&deviceCRC05, batchMessages, batchMessageSizes, batchMessageStates, 65536U);
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedMulti = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    printf("calls                    messages [1/us]\n");
+    printf("api_crc_process          %15.1f\n", 65536.0 / elapsedSeparate / 1000000.0);
+    printf("api_crc_processBatchBits %15.1f\n", 65536.0 / elapsedMulti / 1000000.0);
+    output_Check(state, &batchMessageStates[65535U]);
+
+#ifdef API_CRC_IOVEC
+    //------------------------------------------------------------------------------
+    // Test Case 3.12.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.12.                                                            */\n");
+    printf("/* Performance Test for CRC-32 Reverse LUT on 65536 packets of 1500 bytes in  */\n");
+    printf("/* the segments of 54, 700 and 746 bytes, each segment by api_crc_process,    */\n");
+    printf("/* and each packet by api_crc_processv                                        */\n");
+    printf("/******************************************************************************/\n");
+    uint32_t const packetSegments[3U] = {54U, 700U, 746U};
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (message = 0U; message < 65536U; message++)
+    {
+        api_crc_reset(&device, &state);
+        for (n = 0U, length = (message * 211U) % ((16U << 20U) - 1500U); n < 3U; length += packetSegments[n], n++)
+        {
+            api_crc_process(&device, &state, &bufferData[length], 0U, packetSegments[n] << 3U);
+        }
+        api_crc_finalize(&device, &state);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedSeparate = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (message = 0U; message < 65536U; message++)
+    {
+        for (n = 0U, length = (message * 211U) % ((16U << 20U) - 1500U); n < 3U; length += packetSegments[n], n++)
+        {
+            segments[n].iov_base = &bufferData[length];
+            segments[n].iov_len = packetSegments[n];
+        }
+        api_crc_reset(&device, &stateChunk);
+        api_crc_processv(&device, &stateChunk, segments, 3U);
+        api_crc_finalize(&device, &stateChunk);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedMulti = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    printf("calls                 throughput [MB/s]\n");
+    printf("api_crc_process       %15.1f\n", 65536.0 * 1500.0 / elapsedSeparate / 1000000.0);
+    printf("api_crc_processv      %15.1f\n", 65536.0 * 1500.0 / elapsedMulti / 1000000.0);
+    output_Check(state, &stateChunk);
+#endif // API_CRC_IOVEC
+
+    //------------------------------------------------------------------------------
+    // Test Case 3.13.
+    //------------------------------------------------------------------------------
+    printf("/******************************************************************************/\n");
+    printf("/* Test Case 3.13.                                                            */\n");
+    printf("/* Performance Test for CRC-32 Reverse LUT on 256 frames of 1080 rows of 160  */\n");
+    printf("/* bytes with a pitch of 416 bytes, each row by api_crc_process, and each     */\n");
+    printf("/* frame by api_crc_processStrided                                            */\n");
+    printf("/******************************************************************************/\n");
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (message = 0U; message < 256U; message++)
+    {
+        api_crc_reset(&device, &state);
+        for (n = 0U; n < 1080U; n++)
+        {
+            api_crc_process(&device, &state, &bufferData[message * 4096U + n * 416U], 0U, 160U << 3U);
+        }
+        api_crc_finalize(&device, &state);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedSeparate = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (message = 0U; message < 256U; message++)
+    {
+        api_crc_reset(&device, &stateChunk);
+        api_crc_processStrided(&device, &stateChunk, &bufferData[message * 4096U], 160U, 416U, 1080U);
+        api_crc_finalize(&device, &stateChunk);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+    elapsedMulti = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+
+    printf("calls                  throughput [MB/s]\n");
+    printf("api_crc_process        %15.1f\n", 256.0 * 1080.0 * 160.0 / elapsedSeparate / 1000000.0);
+    printf("api_crc_processStrided %15.1f\n", 256.0 * 1080.0 * 160.0 / elapsedMulti / 1000000.0);
+    output_Check(state, &stateChunk);
 
     return 0;
 }
@@ -836,6 +3046,94 @@ void output_Check(const uint64_t crc_Value, api_crc_state_t *const state)
 }
 
 
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The function measures the throughput of the CRC-process in MB per second.
+//!
+//! \details
+//! Without an eviction buffer, the buffer is processed repeatedly up to 8 MB with
+//! warm caches. With an eviction buffer, it is written before each of 64 calls of
+//! ::api_crc_process, so that the lookup tables are no longer in the caches. Only
+//! the calls of ::api_crc_process are timed.
+//!
+//------------------------------------------------------------------------------
+double crc_throughput(api_crc_device_s const *const device, uint8_t const *const buffer, uint32_t const buffer_size, uint8_t *const evict, uint32_t const evict_size)
+{
+    api_crc_state_t state = 0U;
+    struct timespec timeStart, timeEnd;
+    double elapsed = 0.0;
+    uint32_t const calls = (evict_size == 0U) ? ((8U << 20U) / buffer_size + 1U) : (64U);
+    uint32_t call = 0U;
+    uint32_t n = 0U;
+
+    api_crc_reset(device, &state);
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (call = 0U; call < calls; call++)
+    {
+        if (evict_size != 0U)
+        {
+            for (n = 0U; n < evict_size; n += 64U)
+            {
+                evict[n]++;
+            }
+            clock_gettime(CLOCK_MONOTONIC, &timeStart);
+        }
+
+        api_crc_process(device, &state, buffer, 0U, buffer_size << 3U);
+
+        if (evict_size != 0U)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+            elapsed += (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+        }
+    }
+    if (evict_size == 0U)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+        elapsed = (timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9;
+    }
+
+    return ((double)calls * buffer_size) / elapsed / 1000000.0;
+}
+
+
+//------------------------------------------------------------------------------
+//!
+//! \brief
+//! The function measures the throughput of the content-defined chunking in MB per second.
+//!
+//! \details
+//! The buffer is split into its chunks by ::api_crc_chunk repeatedly up to 64 MB,
+//! the checksums of the chunks are included. The number of the chunks of one pass
+//! is returned in chunks.
+//!
+//------------------------------------------------------------------------------
+double chunk_throughput(api_crc_chunker_s const *const chunker, uint8_t const *const buffer, uint32_t const buffer_size, uint32_t *const chunks)
+{
+    api_crc_state_t state = 0U;
+    struct timespec timeStart, timeEnd;
+    uint32_t const calls = (64U << 20U) / buffer_size + 1U;
+    uint32_t call = 0U;
+    uint32_t length = 0U;
+    uint32_t n = 0U;
+
+    clock_gettime(CLOCK_MONOTONIC, &timeStart);
+    for (call = 0U; call < calls; call++)
+    {
+        (*chunks) = 0U;
+        for (n = 0U; n < buffer_size; n += length)
+        {
+            api_crc_chunk(chunker, &buffer[n], buffer_size - n, &length, &state);
+            (*chunks)++;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+
+    return ((double)calls * buffer_size) / ((timeEnd.tv_sec - timeStart.tv_sec) + (timeEnd.tv_nsec - timeStart.tv_nsec) / 1e9) / 1000000.0;
+}
+
+
 //------------------------------------------------------------------------------
 //!
 //! \} // API_LIBRARY_CRC_TESTS
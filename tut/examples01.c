@@ -96,7 +96,11 @@ int main(void)
         outputXOR,
         0U,
         inputOrder,
-        outputOrder
+        outputOrder,
+        API_CRC_TABLE_BYTE,
+#if (API_CRC_FOLD_SIZE > 0U)
+        {0U}
+#endif // API_CRC_FOLD_SIZE
     };
     api_crc_state_t state = 0U;
     uint8_t offset = 0U;